@@ -0,0 +1,132 @@
+// 关键词匹配基准：Aho-Corasick 单遍匹配 vs 原来的逐关键词小写 contains
+// 用法: bench_keyword_matcher [关键词数，默认60]
+#include "Core/KeywordMatcher.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QRandomGenerator>
+#include <QStringList>
+#include <QTextStream>
+
+namespace {
+
+QTextStream out(stdout);
+
+// 中英文混合的关键词变体（互关类中文短词 + 英文短语）
+QList<Keyword> makeKeywords(int count) {
+  const QStringList base = {"互关",   "回关",        "互粉",     "必回",
+                            "蓝V互关", "follow back", "f4f",      "mutuals",
+                            "新人报到", "求关注",      "gm",       "web3",
+                            "ai",     "crypto",      "airdrop",  "撸毛",
+                            "builder", "互关必回",    "daily",    "alpha"};
+  QList<Keyword> keywords;
+  for (int i = 0; i < count; ++i) {
+    QString text = base[i % base.size()];
+    if (i >= base.size()) {
+      text += QString::number(i / base.size());
+    }
+    keywords.append(Keyword(text));
+  }
+  return keywords;
+}
+
+QStringList makeTexts(int count) {
+  QRandomGenerator rng(20261018);
+  const QStringList words = {
+      "互关", "回关", "今天", "分享", "Follow", "Back", "GM", "everyone",
+      "AI",   "工具", "推荐", "thread", "on",   "Rust", "async", "蓝V",
+      "互粉", "必回", "新人", "报到",   "hello", "world", "crypto", "🚀"};
+  QStringList texts;
+  for (int i = 0; i < count; ++i) {
+    QStringList parts;
+    int n = 10 + rng.bounded(40);
+    for (int j = 0; j < n; ++j) {
+      parts << words[rng.bounded(words.size())];
+    }
+    texts << parts.join(' ');
+  }
+  return texts;
+}
+
+// 原实现：每条帖子对每个关键词做一次小写 contains
+QStringList naiveMatch(const QStringList &keywords,
+                       const QStringList &lowerKeywords, const QString &text) {
+  QString lower = text.toLower();
+  QStringList matched;
+  for (int i = 0; i < keywords.size(); ++i) {
+    if (lower.contains(lowerKeywords[i])) {
+      matched << keywords[i];
+    }
+  }
+  return matched;
+}
+
+double msSince(const QElapsedTimer &timer) {
+  return timer.nsecsElapsed() / 1e6;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  QCoreApplication app(argc, argv);
+  int keywordCount = 60;
+  if (argc > 1) {
+    keywordCount = QString::fromLocal8Bit(argv[1]).toInt();
+  }
+
+  QList<Keyword> keywords = makeKeywords(keywordCount);
+  QStringList texts = makeTexts(20000);
+
+  QElapsedTimer timer;
+  timer.start();
+  KeywordMatcher matcher;
+  matcher.build(keywords);
+  QByteArray json = matcher.toJson();
+  out << QString("keywords: %1, states: %2, build+serialize: %3 ms, json: %4 "
+                 "bytes")
+             .arg(matcher.keywordCount())
+             .arg(matcher.stateCount())
+             .arg(msSince(timer), 0, 'f', 2)
+             .arg(json.size())
+      << Qt::endl;
+
+  QStringList keywordTexts;
+  QStringList lowerKeywords;
+  for (const auto &kw : keywords) {
+    keywordTexts << kw.text;
+    lowerKeywords << kw.text.toLower();
+  }
+
+  // 结果一致性
+  int mismatches = 0;
+  for (const auto &text : texts) {
+    if (matcher.match(text) != naiveMatch(keywordTexts, lowerKeywords, text)) {
+      mismatches++;
+    }
+  }
+  out << "mismatches: " << mismatches << Qt::endl;
+
+  int hits = 0;
+  timer.restart();
+  for (const auto &text : texts) {
+    hits += naiveMatch(keywordTexts, lowerKeywords, text).size();
+  }
+  double naiveMs = msSince(timer);
+
+  int acHits = 0;
+  timer.restart();
+  for (const auto &text : texts) {
+    acHits += matcher.match(text).size();
+  }
+  double acMs = msSince(timer);
+
+  out << QString("contains x%1: %2 us/post (hits %3)")
+             .arg(keywordCount)
+             .arg(naiveMs * 1000.0 / texts.size(), 0, 'f', 2)
+             .arg(hits)
+      << Qt::endl;
+  out << QString("aho-corasick: %1 us/post (hits %2)")
+             .arg(acMs * 1000.0 / texts.size(), 0, 'f', 2)
+             .arg(acHits)
+      << Qt::endl;
+  return 0;
+}
@@ -0,0 +1,110 @@
+// 日志基准测试：调用方单次延迟（异步环形缓冲 vs 原同步 writeLog）
+// 用法: bench_logger [每线程行数，默认20000]
+#include "Utils/Logger.h"
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QVector>
+#include <algorithm>
+#include <thread>
+
+namespace {
+
+QTextStream out(stdout);
+
+// 原 CefHandler::writeLog 的做法：全局锁 + 新建 QTextStream + 每行 flush
+QFile *g_syncFile = nullptr;
+QMutex g_syncMutex;
+
+void syncWriteLog(const QString &msg) {
+  QMutexLocker locker(&g_syncMutex);
+  QTextStream stream(g_syncFile);
+  stream << "[" << QDateTime::currentDateTime().toString("HH:mm:ss.zzz")
+         << "] " << msg << Qt::endl;
+  g_syncFile->flush();
+}
+
+// 多线程各写 lines 行，返回所有调用的单次耗时（微秒）
+template <typename Fn>
+QVector<double> run(int threads, int lines, Fn write) {
+  QVector<QVector<double>> perThread(threads);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t]() {
+      QVector<double> &samples = perThread[t];
+      samples.reserve(lines);
+      QElapsedTimer timer;
+      for (int i = 0; i < lines; ++i) {
+        QString msg = QString("[NEW_POSTS] thread=%1 seq=%2 handle=user_%3")
+                          .arg(t)
+                          .arg(i)
+                          .arg(i * 7919 % 100000);
+        timer.start();
+        write(msg);
+        samples.append(timer.nsecsElapsed() / 1000.0);
+      }
+    });
+  }
+  for (auto &w : workers) {
+    w.join();
+  }
+
+  QVector<double> all;
+  for (const auto &samples : perThread) {
+    all += samples;
+  }
+  std::sort(all.begin(), all.end());
+  return all;
+}
+
+void report(const QString &name, int threads, const QVector<double> &samples) {
+  auto pct = [&](double p) {
+    return samples[qMin(samples.size() - 1, int(samples.size() * p))];
+  };
+  out << QString("%1 threads=%2: p50=%3 us p99=%4 us max=%5 us")
+             .arg(name, -6)
+             .arg(threads)
+             .arg(pct(0.50), 0, 'f', 2)
+             .arg(pct(0.99), 0, 'f', 2)
+             .arg(samples.last(), 0, 'f', 2)
+      << Qt::endl;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  QCoreApplication app(argc, argv);
+  int lines = 20000;
+  if (argc > 1) {
+    lines = QString::fromLocal8Bit(argv[1]).toInt();
+  }
+
+  QTemporaryDir dir;
+  g_syncFile = new QFile(dir.path() + "/sync.log");
+  g_syncFile->open(QIODevice::WriteOnly | QIODevice::Text);
+  Logger::init(dir.path() + "/async");
+
+  out << "lines per thread: " << lines << Qt::endl;
+  for (int threads : {1, 4}) {
+    report("sync", threads, run(threads, lines, syncWriteLog));
+    report("async", threads,
+           run(threads, lines, [](const QString &msg) { Logger::write(msg); }));
+  }
+
+  QElapsedTimer timer;
+  timer.start();
+  Logger::shutdown();
+  out << QString("async shutdown drain: %1 ms, dropped: %2")
+             .arg(timer.nsecsElapsed() / 1e6, 0, 'f', 1)
+             .arg(Logger::droppedCount())
+      << Qt::endl;
+
+  g_syncFile->close();
+  delete g_syncFile;
+  return 0;
+}
@@ -0,0 +1,133 @@
+// SearchIndex 基准测试：构建 / 增量添加 / 查询延迟
+// 用法: bench_search_index [记录数，默认100000]
+#include "Data/SearchIndex.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QRandomGenerator>
+#include <QStringList>
+#include <QTextStream>
+#include <algorithm>
+
+namespace {
+
+QTextStream out(stdout);
+
+// 生成与真实数据形态相近的记录：关键词帖子、被@帖子、粉丝采集记录
+QList<Post> makePosts(int count) {
+  QRandomGenerator rng(20260206);
+  const QStringList words = {
+      "互关", "回关", "必回", "互粉", "蓝V", "follow back", "crypto",
+      "web3", "AI", "币圈", "新人报到", "求关注", "daily", "gm",
+      "airdrop", "撸毛", "早安", "alpha", "NFT", "builder"};
+  const QString letters = "abcdefghijklmnopqrstuvwxyz0123456789_";
+
+  QList<Post> posts;
+  posts.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    Post post;
+    QString handle;
+    int len = 6 + rng.bounded(9);
+    for (int j = 0; j < len; ++j) {
+      handle += letters[rng.bounded(letters.size())];
+    }
+    handle += QString::number(i);
+    post.authorHandle = handle;
+    post.authorName = words[rng.bounded(words.size())] + " " + handle.left(5);
+
+    int kind = rng.bounded(10);
+    if (kind < 5) {
+      post.postId = "followers_" + handle;
+      post.content = "[粉丝采集] 来自互关用户的蓝V粉丝";
+      post.matchedKeyword = "粉丝采集";
+    } else if (kind < 7) {
+      post.postId = "mention_" + handle + "_" + QString::number(i);
+      post.content = QString("[被@] 来自 @%1 的帖子").arg(handle);
+      post.matchedKeyword = "互关 (被@)";
+    } else {
+      post.postId = QString::number(1800000000000000000LL + i);
+      QStringList parts;
+      int n = 8 + rng.bounded(25);
+      for (int j = 0; j < n; ++j) {
+        parts << words[rng.bounded(words.size())];
+      }
+      post.content = parts.join(' ');
+      post.matchedKeyword = words[rng.bounded(4)];
+    }
+    posts.append(post);
+  }
+  return posts;
+}
+
+double msSince(const QElapsedTimer &timer) {
+  return timer.nsecsElapsed() / 1e6;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  QCoreApplication app(argc, argv);
+  int count = 100000;
+  if (argc > 1) {
+    count = QString::fromLocal8Bit(argv[1]).toInt();
+  }
+
+  QList<Post> posts = makePosts(count);
+  out << "records: " << count << Qt::endl;
+
+  // 全量构建
+  SearchIndex index;
+  QElapsedTimer timer;
+  timer.start();
+  index.build(posts);
+  out << QString("build: %1 ms, grams: %2")
+             .arg(msSince(timer), 0, 'f', 1)
+             .arg(index.gramCount())
+      << Qt::endl;
+
+  // 增量添加（模拟一次页面扫描带来的新记录）
+  QList<Post> extra = makePosts(1000);
+  for (auto &post : extra) {
+    post.postId += "_extra";
+  }
+  timer.restart();
+  for (const auto &post : extra) {
+    index.addOrUpdate(post);
+  }
+  out << QString("incremental add: %1 us/record")
+             .arg(msSince(timer) * 1000.0 / extra.size(), 0, 'f', 2)
+      << Qt::endl;
+
+  // 增量删除
+  timer.restart();
+  for (const auto &post : extra) {
+    index.remove(post.postId);
+  }
+  out << QString("incremental remove: %1 us/record")
+             .arg(msSince(timer) * 1000.0 / extra.size(), 0, 'f', 2)
+      << Qt::endl;
+
+  // 查询延迟：短中文词、英文词、handle 片段、长短语、单字符
+  const QStringList queries = {"互关", "回关", "蓝v", "follow back", "crypto",
+                               posts[count / 2].authorHandle.left(6),
+                               "@" + posts[count / 3].authorHandle,
+                               "新人报到 求关注", "粉", "不存在的词"};
+  const int rounds = 20;
+  for (const auto &q : queries) {
+    QVector<double> samples;
+    int hits = 0;
+    for (int r = 0; r < rounds; ++r) {
+      timer.restart();
+      hits = index.matchingPostIds(q).size();
+      samples.append(msSince(timer));
+    }
+    std::sort(samples.begin(), samples.end());
+    out << QString("query %1: hits=%2 median=%3 ms max=%4 ms")
+               .arg(q, -16)
+               .arg(hits)
+               .arg(samples[rounds / 2], 0, 'f', 3)
+               .arg(samples.last(), 0, 'f', 3)
+        << Qt::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,151 @@
+// 时间线响应解析基准：抓取到的 SearchTimeline JSON -> 帖子列表
+// 与 ExtractorBench.html（同样 40 条帖子的 DOM 提取）对照
+// 用法: bench_timeline_parser [保存的响应.json]（不传时生成 40 条帖子的合成响应）
+#include "Core/TimelineParser.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+
+namespace {
+
+QTextStream out(stdout);
+
+QJsonObject makeUser(int i) {
+  QJsonObject core;
+  core["screen_name"] = QString("user_%1").arg(i);
+  core["name"] = QString("互关用户 %1").arg(i);
+  QJsonObject legacy;
+  legacy["followers_count"] = 1000 + i;
+  legacy["description"] = "互关必回 | AI builder | web3";
+  QJsonObject user;
+  user["__typename"] = "User";
+  user["rest_id"] = QString::number(100000 + i);
+  user["is_blue_verified"] = i % 4 != 0;
+  user["core"] = core;
+  user["legacy"] = legacy;
+  return user;
+}
+
+QJsonObject makeTweetEntry(int i) {
+  QString text = QString("@user_%1 互关互粉，蓝V互关必回 🚀 今天分享第 %2 个 AI 工具 "
+                         "https://t.co/abc%2")
+                     .arg(i + 1)
+                     .arg(i);
+  QJsonObject mention;
+  mention["screen_name"] = QString("user_%1").arg(i + 1);
+  QJsonObject url;
+  url["url"] = QString("https://t.co/abc%1").arg(i);
+  url["display_url"] = QString("example.com/tool/%1").arg(i);
+  QJsonObject entities;
+  entities["user_mentions"] = QJsonArray{mention};
+  entities["urls"] = QJsonArray{url};
+  entities["hashtags"] = QJsonArray();
+
+  QJsonObject legacy;
+  legacy["full_text"] = text;
+  legacy["display_text_range"] = QJsonArray{0, text.toUcs4().size()};
+  legacy["created_at"] = "Sat Oct 17 08:30:00 +0000 2026";
+  legacy["entities"] = entities;
+  legacy["favorite_count"] = i * 3;
+  legacy["retweet_count"] = i;
+
+  QJsonObject userResults;
+  userResults["result"] = makeUser(i);
+  QJsonObject core;
+  core["user_results"] = userResults;
+
+  QJsonObject tweet;
+  tweet["__typename"] = "Tweet";
+  tweet["rest_id"] = QString::number(1840000000000000000LL + i);
+  tweet["core"] = core;
+  tweet["legacy"] = legacy;
+  tweet["views"] = QJsonObject{{"count", QString::number(i * 100)}};
+
+  QJsonObject tweetResults;
+  tweetResults["result"] = tweet;
+  QJsonObject itemContent;
+  itemContent["itemType"] = "TimelineTweet";
+  itemContent["__typename"] = "TimelineTweet";
+  itemContent["tweet_results"] = tweetResults;
+  QJsonObject content;
+  content["entryType"] = "TimelineTimelineItem";
+  content["itemContent"] = itemContent;
+  QJsonObject entry;
+  entry["entryId"] = QString("tweet-%1").arg(tweet["rest_id"].toString());
+  entry["content"] = content;
+  return entry;
+}
+
+// data.search_by_raw_query.search_timeline.timeline.instructions[].entries[]
+QByteArray makeSearchResponse(int count) {
+  QJsonArray entries;
+  for (int i = 0; i < count; ++i) {
+    entries.append(makeTweetEntry(i));
+  }
+  QJsonObject instruction;
+  instruction["type"] = "TimelineAddEntries";
+  instruction["entries"] = entries;
+  QJsonObject timeline;
+  timeline["instructions"] = QJsonArray{instruction};
+  QJsonObject searchTimeline;
+  searchTimeline["timeline"] = timeline;
+  QJsonObject query;
+  query["search_timeline"] = searchTimeline;
+  QJsonObject data;
+  data["search_by_raw_query"] = query;
+  QJsonObject root;
+  root["data"] = data;
+  return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  QCoreApplication app(argc, argv);
+
+  QByteArray body;
+  if (argc > 1) {
+    QFile file(QString::fromLocal8Bit(argv[1]));
+    if (!file.open(QIODevice::ReadOnly)) {
+      out << "cannot open " << file.fileName() << Qt::endl;
+      return 1;
+    }
+    body = file.readAll();
+  } else {
+    body = makeSearchResponse(40);
+  }
+
+  TimelineParser::Result result = TimelineParser::parse(body);
+  out << QString("response: %1 KB, ok: %2, posts: %3, users: %4")
+             .arg(body.size() / 1024)
+             .arg(result.ok ? "yes" : "no")
+             .arg(result.posts.size())
+             .arg(result.users.size())
+      << Qt::endl;
+  if (!result.posts.isEmpty()) {
+    out << "first post: "
+        << QJsonDocument(result.posts.first().toObject())
+               .toJson(QJsonDocument::Compact)
+        << Qt::endl;
+  }
+
+  const int iterations = 200;
+  QElapsedTimer timer;
+  timer.start();
+  int items = 0;
+  for (int i = 0; i < iterations; ++i) {
+    TimelineParser::Result r = TimelineParser::parse(body);
+    items += r.posts.size() + r.users.size();
+  }
+  double totalUs = timer.nsecsElapsed() / 1000.0;
+  double perResponse = totalUs / iterations;
+  out << QString("parse: %1 us/response, %2 us/item")
+             .arg(perResponse, 0, 'f', 1)
+             .arg(items > 0 ? totalUs / items : 0.0, 0, 'f', 2)
+      << Qt::endl;
+  return 0;
+}
@@ -0,0 +1,18 @@
+# 保守的 JS 压缩（cmake -P 脚本模式，构建机不需要 node）
+#   cmake -DINPUT=<src.js> -DOUTPUT=<dst.js> -P MinifyJs.cmake
+# 只删除整行注释、行首缩进、行尾空白和空行，保留换行（不依赖分号自动插入规则），
+# 行内 // 不处理（字符串里有 https://）
+if(NOT INPUT OR NOT OUTPUT)
+    message(FATAL_ERROR "MinifyJs.cmake: INPUT and OUTPUT are required")
+endif()
+
+file(READ "${INPUT}" content)
+set(content "\n${content}\n")
+string(REPLACE "\r\n" "\n" content "${content}")
+string(REGEX REPLACE "\n[ \t]*//[^\n]*" "\n" content "${content}")
+string(REGEX REPLACE "\n[ \t]+" "\n" content "${content}")
+string(REGEX REPLACE "[ \t]+\n" "\n" content "${content}")
+string(REGEX REPLACE "\n\n+" "\n" content "${content}")
+string(STRIP "${content}" content)
+
+file(WRITE "${OUTPUT}" "${content}\n")
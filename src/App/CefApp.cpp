@@ -1,10 +1,14 @@
 #include "CefApp.h"
+#include "MessagePump.h"
+#include "RequestContextRegistry.h"
 #include "include/cef_command_line.h"
+#include "include/cef_v8.h"
 #include "include/wrapper/cef_helpers.h"
 #include <Shlwapi.h>
 #include <cwctype>
 #include <fstream>
 #include <sstream>
+#include <vector>
 #include <string>
 #include <windows.h>
 
@@ -70,6 +74,85 @@ static void FixPreferencesExitType(const std::wstring &profileDir) {
   }
 }
 
+// V8 值转换为 CefValue（渲染进程）
+// 只保留可序列化的数据：函数、undefined 转为 null，嵌套过深的部分截断
+static CefRefPtr<CefValue> V8ToCefValue(CefRefPtr<CefV8Value> value,
+                                        int depth) {
+  const int kMaxDepth = 16;
+  CefRefPtr<CefValue> out = CefValue::Create();
+  if (!value || !value->IsValid() || depth > kMaxDepth || value->IsNull() ||
+      value->IsUndefined() || value->IsFunction()) {
+    out->SetNull();
+  } else if (value->IsBool()) {
+    out->SetBool(value->GetBoolValue());
+  } else if (value->IsInt()) {
+    out->SetInt(value->GetIntValue());
+  } else if (value->IsUInt() || value->IsDouble()) {
+    out->SetDouble(value->GetDoubleValue());
+  } else if (value->IsString()) {
+    out->SetString(value->GetStringValue());
+  } else if (value->IsArray()) {
+    CefRefPtr<CefListValue> list = CefListValue::Create();
+    int length = value->GetArrayLength();
+    list->SetSize(length);
+    for (int i = 0; i < length; ++i) {
+      list->SetValue(i, V8ToCefValue(value->GetValue(i), depth + 1));
+    }
+    out->SetList(list);
+  } else if (value->IsObject()) {
+    CefRefPtr<CefDictionaryValue> dict = CefDictionaryValue::Create();
+    std::vector<CefString> keys;
+    value->GetKeys(keys);
+    for (const auto &key : keys) {
+      CefRefPtr<CefV8Value> child = value->GetValue(key);
+      if (child && !child->IsFunction()) {
+        dict->SetValue(key, V8ToCefValue(child, depth + 1));
+      }
+    }
+    out->SetDictionary(dict);
+  } else {
+    out->SetNull();
+  }
+  return out;
+}
+
+// window.xfollowing.emit(type, payload) 的实现（渲染进程）
+class XfEmitHandler : public CefV8Handler {
+public:
+  bool Execute(const CefString &name, CefRefPtr<CefV8Value> object,
+               const CefV8ValueList &arguments, CefRefPtr<CefV8Value> &retval,
+               CefString &exception) override {
+    if (arguments.empty() || !arguments[0]->IsString()) {
+      exception = "xfollowing.emit(type, payload): type must be a string";
+      return true;
+    }
+
+    CefRefPtr<CefV8Context> context = CefV8Context::GetCurrentContext();
+    CefRefPtr<CefFrame> frame = context ? context->GetFrame() : nullptr;
+    if (!frame) {
+      retval = CefV8Value::CreateBool(false);
+      return true;
+    }
+
+    CefRefPtr<CefProcessMessage> message =
+        CefProcessMessage::Create(XfIpc::kEmitMessage);
+    CefRefPtr<CefListValue> args = message->GetArgumentList();
+    args->SetString(0, arguments[0]->GetStringValue());
+    if (arguments.size() > 1) {
+      args->SetValue(1, V8ToCefValue(arguments[1], 0));
+    } else {
+      args->SetNull(1);
+    }
+    frame->SendProcessMessage(PID_BROWSER, message);
+
+    retval = CefV8Value::CreateBool(true);
+    return true;
+  }
+
+private:
+  IMPLEMENT_REFCOUNTING(XfEmitHandler);
+};
+
 BrowserApp::BrowserApp() {}
 
 void BrowserApp::OnBeforeCommandLineProcessing(
@@ -161,6 +244,98 @@ void BrowserApp::OnContextInitialized() {
   // Browser context initialized
 }
 
+void BrowserApp::OnScheduleMessagePumpWork(int64_t delay_ms) {
+  // 可能在任意线程调用，由 MessagePump 转到 Qt 主线程
+  MessagePump::scheduleWork(delay_ms);
+}
+
+void BrowserApp::OnBrowserCreated(CefRefPtr<CefBrowser> browser,
+                                  CefRefPtr<CefDictionaryValue> extra_info) {
+  if (!extra_info || !extra_info->HasKey(XfIpc::kScriptKey)) {
+    return;
+  }
+  StartupScript &script = m_startupScripts[browser->GetIdentifier()];
+  script.role = extra_info->GetString(XfIpc::kRoleKey).ToString();
+  script.prelude = extra_info->GetString(XfIpc::kPreludeKey).ToString();
+  script.code = extra_info->GetString(XfIpc::kScriptKey).ToString();
+}
+
+void BrowserApp::OnBrowserDestroyed(CefRefPtr<CefBrowser> browser) {
+  m_startupScripts.erase(browser->GetIdentifier());
+}
+
+bool BrowserApp::OnProcessMessageReceived(
+    CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame,
+    CefProcessId source_process, CefRefPtr<CefProcessMessage> message) {
+  // 下一次创建上下文（导航/刷新）时生效
+  CefRefPtr<CefListValue> args = message->GetArgumentList();
+  if (message->GetName() == XfIpc::kStartupPreludeMessage) {
+    m_startupScripts[browser->GetIdentifier()].prelude =
+        args->GetString(0).ToString();
+    return true;
+  }
+  if (message->GetName() != XfIpc::kStartupScriptMessage) {
+    return false;
+  }
+  StartupScript &script = m_startupScripts[browser->GetIdentifier()];
+  script.role = args->GetString(0).ToString();
+  script.code = args->GetString(1).ToString();
+  return true;
+}
+
+void BrowserApp::OnContextCreated(CefRefPtr<CefBrowser> browser,
+                                  CefRefPtr<CefFrame> frame,
+                                  CefRefPtr<CefV8Context> context) {
+  // 注入脚本只在主框架执行，子框架（广告、登录iframe）不暴露通道
+  if (!frame->IsMain()) {
+    return;
+  }
+
+  const cef_v8_propertyattribute_t attributes =
+      static_cast<cef_v8_propertyattribute_t>(V8_PROPERTY_ATTRIBUTE_READONLY |
+                                              V8_PROPERTY_ATTRIBUTE_DONTENUM |
+                                              V8_PROPERTY_ATTRIBUTE_DONTDELETE);
+
+  CefRefPtr<CefV8Value> bridge = CefV8Value::CreateObject(nullptr, nullptr);
+  bridge->SetValue("emit",
+                   CefV8Value::CreateFunction("emit", new XfEmitHandler()),
+                   attributes);
+  context->GetGlobal()->SetValue(XfIpc::kBridgeObject, bridge, attributes);
+
+  // 跨站导航或崩溃后渲染进程会变，每次上下文创建都重新上报
+  CefRefPtr<CefProcessMessage> info =
+      CefProcessMessage::Create(XfIpc::kRendererInfoMessage);
+  info->GetArgumentList()->SetInt(0, static_cast<int>(GetCurrentProcessId()));
+  frame->SendProcessMessage(PID_BROWSER, info);
+
+  // 角色脚本在文档开始时执行，页面脚本还没运行、document.body 还不存在；
+  // 前置数据单独执行，脚本的行号不受影响
+  auto it = m_startupScripts.find(browser->GetIdentifier());
+  if (it == m_startupScripts.end() || it->second.code.empty()) {
+    return;
+  }
+  auto eval = [&](const std::string &code, const std::string &name) {
+    CefRefPtr<CefV8Value> retval;
+    CefRefPtr<CefV8Exception> exception;
+    if (!context->Eval(code, "xfollowing://" + name + ".js", 1, retval,
+                       exception) &&
+        exception) {
+      CefRefPtr<CefProcessMessage> error =
+          CefProcessMessage::Create(XfIpc::kEmitMessage);
+      CefRefPtr<CefListValue> args = error->GetArgumentList();
+      args->SetString(0, "SCRIPT_ERROR");
+      args->SetString(1, name + ":" +
+                             std::to_string(exception->GetLineNumber()) + " " +
+                             exception->GetMessage().ToString());
+      frame->SendProcessMessage(PID_BROWSER, error);
+    }
+  };
+  if (!it->second.prelude.empty()) {
+    eval(it->second.prelude, it->second.role + "_prelude");
+  }
+  eval(it->second.code, it->second.role);
+}
+
 namespace CefHelper {
 
 bool Initialize(int argc, char *argv[]) {
@@ -261,8 +436,13 @@ bool Initialize(int argc, char *argv[]) {
   return CefInitialize(main_args, settings, app.get(), nullptr);
 }
 
-void Shutdown() { CefShutdown(); }
+void StartMessagePump() { MessagePump::start(); }
 
-void DoMessageLoopWork() { CefDoMessageLoopWork(); }
+void Shutdown() {
+  MessagePump::stop();
+  RequestContextRegistry::clear();
+  CefShutdown();
+  MessagePump::destroy();
+}
 
 } // namespace CefHelper
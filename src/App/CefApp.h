@@ -3,9 +3,34 @@
 
 #include "include/cef_app.h"
 #include "include/cef_browser.h"
+#include "include/cef_render_process_handler.h"
+#include <map>
+#include <string>
 
-// CefApp implementation for browser process
-class BrowserApp : public CefApp, public CefBrowserProcessHandler {
+// 注入脚本 -> 浏览器进程的消息通道
+// 渲染进程在每个主框架上下文中安装 window.xfollowing.emit(type, payload)，
+// payload 转成 CefValue 后以进程消息 [type, payload] 发送，由 CefHandler 按 type 分发
+namespace XfIpc {
+    const char kEmitMessage[] = "xfollowing.emit";
+    const char kBridgeObject[] = "xfollowing";
+    // 渲染进程在主框架上下文创建时上报自身 PID，用于按浏览器统计 CPU/内存
+    const char kRendererInfoMessage[] = "xfollowing.renderer";
+
+    // 文档开始脚本：按浏览器角色注册，在渲染进程 OnContextCreated 中执行
+    // 创建浏览器时通过 extra_info 带上，之后的更新用进程消息 [role, script] 发给渲染进程
+    const char kStartupScriptMessage[] = "xfollowing.startupScript";
+    const char kRoleKey[] = "xfRole";
+    const char kScriptKey[] = "xfScript";
+    // 前置数据（如关键词自动机）：在脚本之前执行，单独更新 [prelude]，
+    // 数据变化时不必重发整个脚本
+    const char kStartupPreludeMessage[] = "xfollowing.startupPrelude";
+    const char kPreludeKey[] = "xfPrelude";
+}
+
+// CefApp implementation for browser process (and render subprocesses)
+class BrowserApp : public CefApp,
+                   public CefBrowserProcessHandler,
+                   public CefRenderProcessHandler {
 public:
     BrowserApp();
 
@@ -13,6 +38,9 @@ public:
     CefRefPtr<CefBrowserProcessHandler> GetBrowserProcessHandler() override {
         return this;
     }
+    CefRefPtr<CefRenderProcessHandler> GetRenderProcessHandler() override {
+        return this;
+    }
 
     // Override to add command line switches
     void OnBeforeCommandLineProcessing(
@@ -21,8 +49,29 @@ public:
 
     // CefBrowserProcessHandler methods
     void OnContextInitialized() override;
+    void OnScheduleMessagePumpWork(int64_t delay_ms) override;
+
+    // CefRenderProcessHandler methods (runs in the renderer)
+    void OnBrowserCreated(CefRefPtr<CefBrowser> browser,
+                          CefRefPtr<CefDictionaryValue> extra_info) override;
+    void OnBrowserDestroyed(CefRefPtr<CefBrowser> browser) override;
+    void OnContextCreated(CefRefPtr<CefBrowser> browser,
+                          CefRefPtr<CefFrame> frame,
+                          CefRefPtr<CefV8Context> context) override;
+    bool OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
+                                  CefRefPtr<CefFrame> frame,
+                                  CefProcessId source_process,
+                                  CefRefPtr<CefProcessMessage> message) override;
 
 private:
+    // 渲染进程：browser id -> 文档开始脚本（只在渲染线程访问）
+    struct StartupScript {
+        std::string role;
+        std::string prelude;
+        std::string code;
+    };
+    std::map<int, StartupScript> m_startupScripts;
+
     IMPLEMENT_REFCOUNTING(BrowserApp);
     DISALLOW_COPY_AND_ASSIGN(BrowserApp);
 };
@@ -30,8 +79,8 @@ private:
 // Helper functions for CEF initialization
 namespace CefHelper {
     bool Initialize(int argc, char* argv[]);
+    void StartMessagePump(); // 需在 QApplication 创建之后调用
     void Shutdown();
-    void DoMessageLoopWork();
 }
 
 #endif // CEFAPP_H
@@ -1,59 +1,212 @@
 #include "CefHandler.h"
+#include "CefApp.h"
+#include "Utils/Logger.h"
 #include "include/wrapper/cef_helpers.h"
 #include <QDebug>
-#include <QFile>
-#include <QTextStream>
-#include <QCoreApplication>
-#include <QDir>
-#include <QDateTime>
-#include <QMutex>
-#include <QThread>
+#include <QJsonObject>
+#include <QStringList>
+#include <QVariant>
 #include <windows.h>
 
-// Global log file for debugging
-static QFile* g_logFile = nullptr;
-static QMutex g_logMutex;
+// 调试日志只写文件，由 Logger 的写线程异步批量落盘
+void writeLog(const QString& msg) {
+    Logger::write(msg);
+}
 
-static void initLog() {
-    if (g_logFile) return;
+// CefValue 转换为 QJsonValue（浏览器进程）
+static QJsonValue cefValueToJson(CefRefPtr<CefValue> value) {
+    if (!value) {
+        return QJsonValue();
+    }
+    switch (value->GetType()) {
+        case VTYPE_BOOL:
+            return value->GetBool();
+        case VTYPE_INT:
+            return value->GetInt();
+        case VTYPE_DOUBLE:
+            return value->GetDouble();
+        case VTYPE_STRING:
+            return QString::fromStdWString(value->GetString().ToWString());
+        case VTYPE_LIST: {
+            CefRefPtr<CefListValue> list = value->GetList();
+            QJsonArray arr;
+            for (size_t i = 0; i < list->GetSize(); ++i) {
+                arr.append(cefValueToJson(list->GetValue(i)));
+            }
+            return arr;
+        }
+        case VTYPE_DICTIONARY: {
+            CefRefPtr<CefDictionaryValue> dict = value->GetDictionary();
+            CefDictionaryValue::KeyList keys;
+            dict->GetKeys(keys);
+            QJsonObject obj;
+            for (const auto& key : keys) {
+                obj.insert(QString::fromStdWString(key.ToWString()),
+                           cefValueToJson(dict->GetValue(key)));
+            }
+            return obj;
+        }
+        default:
+            return QJsonValue();
+    }
+}
 
-    QString logDir = QCoreApplication::applicationDirPath() + "/logs";
-    QDir dir(logDir);
-    if (!dir.exists()) {
-        dir.mkpath(".");
+static QString cefValueToString(CefRefPtr<CefValue> value) {
+    if (!value || value->GetType() != VTYPE_STRING) {
+        return QString();
     }
+    return QString::fromStdWString(value->GetString().ToWString());
+}
+
+CefHandler::CefHandler(QObject* parent)
+    : QObject(parent)
+    , m_isClosing(false)
+    , m_resourceFilter(new ResourceFilter("user", ResourcePolicy::allowAll())) {
+    registerEmitHandlers();
+}
 
-    QString timestamp = QDateTime::currentDateTime().toString("yyyyMMdd_HHmmss");
-    QString logPath = logDir + "/debug_" + timestamp + ".log";
-
-    g_logFile = new QFile(logPath);
-    if (g_logFile->open(QIODevice::WriteOnly | QIODevice::Text)) {
-        QTextStream out(g_logFile);
-        out << "=== X互关宝 Debug Log Started: " << QDateTime::currentDateTime().toString() << " ===" << Qt::endl;
-        qDebug() << "[INFO] Log file created:" << logPath;
-    } else {
-        qWarning() << "[ERROR] Failed to create log file:" << logPath;
-        delete g_logFile;
-        g_logFile = nullptr;
+void CefHandler::SetStartupScript(const QString& role, const std::string& script) {
+    m_scriptRole = role.toStdString();
+    m_startupScript = script;
+    m_startupScriptChanged = true;
+    if (!m_browser) {
+        return;
     }
+    CefRefPtr<CefProcessMessage> message = CefProcessMessage::Create(XfIpc::kStartupScriptMessage);
+    CefRefPtr<CefListValue> args = message->GetArgumentList();
+    args->SetString(0, m_scriptRole);
+    args->SetString(1, m_startupScript);
+    m_browser->GetMainFrame()->SendProcessMessage(PID_RENDERER, message);
+    m_syncedRendererPid = m_rendererPid;
 }
 
-void writeLog(const QString& msg) {
-    QMutexLocker locker(&g_logMutex);
-    initLog();
-    if (g_logFile && g_logFile->isOpen()) {
-        QTextStream out(g_logFile);
-        out << "[" << QDateTime::currentDateTime().toString("HH:mm:ss.zzz") << "] " << msg << Qt::endl;
-        g_logFile->flush();
+void CefHandler::SetStartupPrelude(const std::string& prelude) {
+    m_startupPrelude = prelude;
+    m_startupScriptChanged = true;
+    if (!m_browser) {
+        return;
     }
+    CefRefPtr<CefProcessMessage> message = CefProcessMessage::Create(XfIpc::kStartupPreludeMessage);
+    message->GetArgumentList()->SetString(0, m_startupPrelude);
+    m_browser->GetMainFrame()->SendProcessMessage(PID_RENDERER, message);
+    m_syncedRendererPid = m_rendererPid;
 }
 
-CefHandler::CefHandler(QObject* parent)
-    : QObject(parent)
-    , m_isClosing(false) {
+CefRefPtr<CefDictionaryValue> CefHandler::CreateExtraInfo() {
+    m_startupScriptChanged = false;
+    if (m_startupScript.empty()) {
+        return nullptr;
+    }
+    CefRefPtr<CefDictionaryValue> extraInfo = CefDictionaryValue::Create();
+    extraInfo->SetString(XfIpc::kRoleKey, m_scriptRole);
+    extraInfo->SetString(XfIpc::kPreludeKey, m_startupPrelude);
+    extraInfo->SetString(XfIpc::kScriptKey, m_startupScript);
+    return extraInfo;
+}
+
+void CefHandler::SetResourcePolicy(const QString& label, const ResourcePolicy& policy) {
+    m_resourceFilter = new ResourceFilter(label, policy);
+    if (policy.captureApi) {
+        // IO 线程发出信号，接收方在主线程，Qt 自动排队
+        m_resourceFilter->setCaptureSink([this](const std::string& operation, std::string body) {
+            emit apiResponseCaptured(QString::fromStdString(operation),
+                                     QByteArray::fromStdString(body));
+        });
+    }
+}
+
+CefRefPtr<CefResourceRequestHandler> CefHandler::GetResourceRequestHandler(
+    CefRefPtr<CefBrowser> browser,
+    CefRefPtr<CefFrame> frame,
+    CefRefPtr<CefRequest> request,
+    bool is_navigation,
+    bool is_download,
+    const CefString& request_initiator,
+    bool& disable_default_handling) {
+    // 放行的请求也经过过滤器，用于统计实际加载的字节数
+    return m_resourceFilter;
+}
+
+void CefHandler::registerEmitHandlers() {
+    // 账号类消息：payload 为 userHandle 字符串
+    auto handleMessage = [this](const char* tag, void (CefHandler::*signal)(const QString&)) {
+        return [this, tag, signal](CefRefPtr<CefValue> payload) {
+            QString userHandle = cefValueToString(payload);
+            writeLog(QString("[%1] %2").arg(tag, userHandle));
+            emit (this->*signal)(userHandle);
+        };
+    };
+    // 列表类消息：payload 为对象数组
+    auto arrayMessage = [this](const char* tag, void (CefHandler::*signal)(const QJsonArray&)) {
+        return [this, tag, signal](CefRefPtr<CefValue> payload) {
+            QJsonArray arr = cefValueToJson(payload).toArray();
+            writeLog(QString("[%1] %2 items").arg(tag).arg(arr.size()));
+            emit (this->*signal)(arr);
+        };
+    };
+
+    m_emitHandlers = {
+        {"NEW_POSTS", arrayMessage("NEW_POSTS", &CefHandler::newPostsFound)},
+        {"NEW_FOLLOWERS", arrayMessage("NEW_FOLLOWERS", &CefHandler::newFollowersFound)},
+        {"FOLLOWBACK_DETECTED", arrayMessage("FOLLOWBACK_DETECTED", &CefHandler::followBackDetected)},
+        {"FOLLOWBACK_SNAPSHOT", arrayMessage("FOLLOWBACK_SNAPSHOT", &CefHandler::followerSnapshotReceived)},
+        {"FOLLOWBACK_SNAPSHOT_DONE", [this](CefRefPtr<CefValue> payload) {
+             QJsonObject result = cefValueToJson(payload).toObject();
+             writeLog(QString("[FOLLOWBACK_SNAPSHOT_DONE] complete=%1 count=%2")
+                          .arg(result.value("complete").toBool())
+                          .arg(result.value("count").toInt()));
+             emit followerSnapshotDone(result.value("complete").toBool(),
+                                       result.value("count").toInt());
+         }},
+        {"FOLLOW_SUCCESS", handleMessage("FOLLOW_SUCCESS", &CefHandler::followSuccess)},
+        {"ALREADY_FOLLOWING", handleMessage("ALREADY_FOLLOWING", &CefHandler::alreadyFollowing)},
+        {"FOLLOW_FAILED", handleMessage("FOLLOW_FAILED", &CefHandler::followFailed)},
+        {"ACCOUNT_SUSPENDED", handleMessage("ACCOUNT_SUSPENDED", &CefHandler::accountSuspended)},
+        {"CHECK_FOLLOWS_BACK", handleMessage("CHECK_FOLLOWS_BACK", &CefHandler::checkFollowsBack)},
+        {"CHECK_NOT_FOLLOW_BACK", handleMessage("CHECK_NOT_FOLLOW_BACK", &CefHandler::checkNotFollowBack)},
+        {"CHECK_SUSPENDED", handleMessage("CHECK_SUSPENDED", &CefHandler::checkSuspended)},
+        {"CHECK_NOT_FOLLOWING", handleMessage("CHECK_NOT_FOLLOWING", &CefHandler::checkNotFollowing)},
+        {"UNFOLLOW_SUCCESS", handleMessage("UNFOLLOW_SUCCESS", &CefHandler::unfollowSuccess)},
+        {"UNFOLLOW_FAILED", handleMessage("UNFOLLOW_FAILED", &CefHandler::unfollowFailed)},
+        {"USER_LOGGED_IN", [this](CefRefPtr<CefValue>) {
+             writeLog("[USER_LOGGED_IN]");
+             emit userLoggedIn();
+         }},
+        {"METRIC", [](CefRefPtr<CefValue> payload) {
+             // 各脚本上报的字段不同（firstDetection、scan 等），按 key=value 原样输出
+             QJsonObject metric = cefValueToJson(payload).toObject();
+             QStringList fields;
+             for (auto it = metric.constBegin(); it != metric.constEnd(); ++it) {
+                 if (it.key() != "name") {
+                     fields << it.key() + "=" + it.value().toVariant().toString();
+                 }
+             }
+             xfInfo(lcMonitor).noquote() << "[METRIC]" << metric.value("name").toString()
+                                         << fields.join(' ');
+         }},
+        {"SCRIPT_ERROR", [](CefRefPtr<CefValue> payload) {
+             xfWarning(lcCef) << "Startup script error:" << cefValueToString(payload);
+         }},
+        {"JS_RESULT", [this](CefRefPtr<CefValue> payload) {
+             QString result = cefValueToString(payload);
+             writeLog("[JSRESULT] " + result.left(500));
+             emit jsResultReceived(result);
+         }},
+    };
+}
+
+void CefHandler::dispatchEmit(const std::string& type, CefRefPtr<CefValue> payload) {
+    auto it = m_emitHandlers.find(type);
+    if (it == m_emitHandlers.end()) {
+        xfWarning(lcCef) << "Unknown xfollowing.emit type:" << QString::fromStdString(type);
+        return;
+    }
+    it->second(payload);
 }
 
 CefHandler::~CefHandler() {
+    // 进行中的请求可能比 handler 活得久，解除对 this 的引用
+    m_resourceFilter->setCaptureSink(nullptr);
 }
 
 bool CefHandler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
@@ -62,6 +215,35 @@ bool CefHandler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
                                           CefRefPtr<CefProcessMessage> message) {
     const std::string& name = message->GetName();
 
+    // 注入脚本通过 xfollowing.emit 发来的结构化消息
+    if (name == XfIpc::kEmitMessage) {
+        CefRefPtr<CefListValue> args = message->GetArgumentList();
+        if (args->GetSize() > 0) {
+            dispatchEmit(args->GetString(0).ToString(),
+                         args->GetSize() > 1 ? args->GetValue(1) : nullptr);
+        }
+        return true;
+    }
+
+    if (name == XfIpc::kRendererInfoMessage) {
+        CefRefPtr<CefListValue> args = message->GetArgumentList();
+        if (args->GetSize() > 0) {
+            qint64 pid = args->GetInt(0);
+            m_rendererPid = pid;
+            // 换了渲染进程：新进程只拿到创建时 extra_info 里的旧版本，并且已经执行过。
+            // 补发最新版本给之后的导航用（每个进程一次）；当前页面只重新执行前置数据，
+            // 脚本本体不重跑，避免重复初始化
+            if (m_startupScriptChanged && pid != m_syncedRendererPid) {
+                SetStartupPrelude(m_startupPrelude);
+                SetStartupScript(QString::fromStdString(m_scriptRole), m_startupScript);
+                if (!m_startupPrelude.empty()) {
+                    frame->ExecuteJavaScript(m_startupPrelude, frame->GetURL(), 0);
+                }
+            }
+        }
+        return true;
+    }
+
     if (name == "N_JsResult") {
         CefRefPtr<CefListValue> args = message->GetArgumentList();
         if (args->GetSize() > 0) {
@@ -94,7 +276,7 @@ bool CefHandler::OnBeforePopup(CefRefPtr<CefBrowser> browser,
         url.find("google.com/signin") != std::string::npos ||
         url.find("google.com/o/oauth") != std::string::npos ||
         url.find("accounts.youtube.com") != std::string::npos) {
-        qDebug() << "[INFO] Allow Google login popup:" << QString::fromStdString(url);
+        xfInfo(lcCef) << "Allow Google login popup:" << QString::fromStdString(url);
         return false;
     }
 
@@ -103,12 +285,12 @@ bool CefHandler::OnBeforePopup(CefRefPtr<CefBrowser> browser,
         url.find("x.com/i/oauth") != std::string::npos ||
         url.find("api.twitter.com") != std::string::npos ||
         url.find("api.x.com") != std::string::npos) {
-        qDebug() << "[INFO] Allow Twitter login popup:" << QString::fromStdString(url);
+        xfInfo(lcCef) << "Allow Twitter login popup:" << QString::fromStdString(url);
         return false;
     }
 
     // Block other popups
-    qDebug() << "[INFO] Block popup:" << QString::fromStdString(url);
+    xfInfo(lcCef) << "Block popup:" << QString::fromStdString(url);
     return true;
 }
 
@@ -184,6 +366,9 @@ void CefHandler::OnBeforeClose(CefRefPtr<CefBrowser> browser) {
 
     if (m_browserList.empty()) {
         m_browser = nullptr;
+        m_rendererPid = 0;
+        m_syncedRendererPid = 0;
+        m_resourceFilter->logStats();
         emit browserClosed();
     }
 }
@@ -220,8 +405,8 @@ void CefHandler::OnLoadError(CefRefPtr<CefBrowser> browser,
     }
 
     if (frame->IsMain()) {
-        qWarning() << "[ERROR] Load failed:" << QString::fromStdString(errorText.ToString())
-                   << "URL:" << QString::fromStdString(failedUrl.ToString());
+        xfWarning(lcCef) << "Load failed:" << QString::fromStdString(errorText.ToString())
+                         << "URL:" << QString::fromStdString(failedUrl.ToString());
         emit loadFinished(false);
     }
 }
@@ -249,107 +434,22 @@ void CefHandler::ExecuteJavaScript(const QString& code) {
     }
 }
 
+void CefHandler::ExecuteJavaScript(const std::string& code) {
+    if (m_browser && m_browser->GetMainFrame()) {
+        m_browser->GetMainFrame()->ExecuteJavaScript(code, "", 0);
+    }
+}
+
 bool CefHandler::OnConsoleMessage(CefRefPtr<CefBrowser> browser,
                                    cef_log_severity_t level,
                                    const CefString& message,
                                    const CefString& source,
                                    int line) {
+    // 脚本结果走 xfollowing.emit 进程消息，这里只记录脚本自己的调试输出
     QString msg = QString::fromStdString(message.ToString());
-
-    // Log for debugging
     if (msg.startsWith("[XFOLLOW]") || msg.startsWith("[DEBUG]")) {
-        writeLog(msg);
-        qDebug() << msg;
-    }
-
-    // X互关宝: 检测新帖子
-    if (msg.startsWith("XFOLLOWING_NEW_POSTS:")) {
-        QString jsonData = msg.mid(21);
-        writeLog("[NEW_POSTS] " + jsonData.left(500));
-        emit newPostsFound(jsonData);
-    }
-    // X互关宝: 关注成功
-    else if (msg.startsWith("XFOLLOWING_FOLLOW_SUCCESS:")) {
-        QString userHandle = msg.mid(26);
-        writeLog("[FOLLOW_SUCCESS] " + userHandle);
-        emit followSuccess(userHandle);
-    }
-    // X互关宝: 已关注
-    else if (msg.startsWith("XFOLLOWING_ALREADY_FOLLOWING:")) {
-        QString userHandle = msg.mid(29);
-        writeLog("[ALREADY_FOLLOWING] " + userHandle);
-        emit alreadyFollowing(userHandle);
-    }
-    // X互关宝: 关注失败
-    else if (msg.startsWith("XFOLLOWING_FOLLOW_FAILED:")) {
-        QString userHandle = msg.mid(25);
-        writeLog("[FOLLOW_FAILED] " + userHandle);
-        emit followFailed(userHandle);
-    }
-    // X互关宝: 账号被封禁
-    else if (msg.startsWith("XFOLLOWING_ACCOUNT_SUSPENDED:")) {
-        QString userHandle = msg.mid(29);
-        writeLog("[ACCOUNT_SUSPENDED] " + userHandle);
-        emit accountSuspended(userHandle);
-    }
-    // X互关宝: 回关检查 - 对方回关了
-    else if (msg.startsWith("XFOLLOWING_CHECK_FOLLOWS_BACK:")) {
-        QString userHandle = msg.mid(30);
-        writeLog("[CHECK_FOLLOWS_BACK] " + userHandle);
-        emit checkFollowsBack(userHandle);
-    }
-    // X互关宝: 回关检查 - 对方没有回关
-    else if (msg.startsWith("XFOLLOWING_CHECK_NOT_FOLLOW_BACK:")) {
-        QString userHandle = msg.mid(33);
-        writeLog("[CHECK_NOT_FOLLOW_BACK] " + userHandle);
-        emit checkNotFollowBack(userHandle);
-    }
-    // X互关宝: 回关检查 - 账号被封禁
-    else if (msg.startsWith("XFOLLOWING_CHECK_SUSPENDED:")) {
-        QString userHandle = msg.mid(27);
-        writeLog("[CHECK_SUSPENDED] " + userHandle);
-        emit checkSuspended(userHandle);
-    }
-    // X互关宝: 回关检查 - 我没有关注对方
-    else if (msg.startsWith("XFOLLOWING_CHECK_NOT_FOLLOWING:")) {
-        QString userHandle = msg.mid(31);
-        writeLog("[CHECK_NOT_FOLLOWING] " + userHandle);
-        emit checkNotFollowing(userHandle);
-    }
-    // X互关宝: 取消关注成功
-    else if (msg.startsWith("XFOLLOWING_UNFOLLOW_SUCCESS:")) {
-        QString userHandle = msg.mid(28);
-        writeLog("[UNFOLLOW_SUCCESS] " + userHandle);
-        emit unfollowSuccess(userHandle);
-    }
-    // X互关宝: 取消关注失败
-    else if (msg.startsWith("XFOLLOWING_UNFOLLOW_FAILED:")) {
-        QString userHandle = msg.mid(27);
-        writeLog("[UNFOLLOW_FAILED] " + userHandle);
-        emit unfollowFailed(userHandle);
-    }
-    // X互关宝: 粉丝采集
-    else if (msg.startsWith("XFOLLOWING_NEW_FOLLOWERS:")) {
-        QString jsonData = msg.mid(25);
-        writeLog("[NEW_FOLLOWERS] " + jsonData.left(500));
-        emit newFollowersFound(jsonData);
-    }
-    // X互关宝: 用户已登录
-    else if (msg.startsWith("XFOLLOWING_USER_LOGGED_IN")) {
-        writeLog("[USER_LOGGED_IN]");
-        emit userLoggedIn();
-    }
-    // X互关宝: 回关探测
-    else if (msg.startsWith("XFOLLOWING_FOLLOWBACK_DETECTED:")) {
-        QString jsonData = msg.mid(31);
-        writeLog("[FOLLOWBACK_DETECTED] " + jsonData.left(500));
-        emit followBackDetected(jsonData);
-    }
-    // Check if this is a JS result message
-    else if (msg.startsWith("[JSRESULT]")) {
-        QString result = msg.mid(10).trimmed();
-        writeLog("[JSRESULT] " + result.left(500) + "...");
-        emit jsResultReceived(result);
+        // 消息处理器已按分类写入日志文件，不再另外 writeLog
+        xfDebug(lcCef).noquote() << msg;
     }
 
     return false;
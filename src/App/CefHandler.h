@@ -7,10 +7,17 @@
 #include "include/cef_display_handler.h"
 #include "include/cef_context_menu_handler.h"
 #include "include/cef_keyboard_handler.h"
+#include "include/cef_request_handler.h"
+#include "ResourcePolicy.h"
+#include <QByteArray>
+#include <QJsonArray>
+#include <QJsonValue>
 #include <QObject>
 #include <QString>
 #include <list>
 #include <functional>
+#include <string>
+#include <unordered_map>
 #include <windows.h>
 
 class CefHandler : public QObject,
@@ -19,7 +26,8 @@ class CefHandler : public QObject,
                    public CefLoadHandler,
                    public CefDisplayHandler,
                    public CefContextMenuHandler,
-                   public CefKeyboardHandler {
+                   public CefKeyboardHandler,
+                   public CefRequestHandler {
     Q_OBJECT
 
 public:
@@ -32,6 +40,7 @@ public:
     CefRefPtr<CefDisplayHandler> GetDisplayHandler() override { return this; }
     CefRefPtr<CefContextMenuHandler> GetContextMenuHandler() override { return this; }
     CefRefPtr<CefKeyboardHandler> GetKeyboardHandler() override { return this; }
+    CefRefPtr<CefRequestHandler> GetRequestHandler() override { return this; }
     bool OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
                                   CefRefPtr<CefFrame> frame,
                                   CefProcessId source_process,
@@ -92,12 +101,36 @@ public:
                        CefEventHandle os_event,
                        bool* is_keyboard_shortcut) override;
 
+    // CefRequestHandler methods - per-browser resource policy (IO thread)
+    CefRefPtr<CefResourceRequestHandler> GetResourceRequestHandler(
+        CefRefPtr<CefBrowser> browser,
+        CefRefPtr<CefFrame> frame,
+        CefRefPtr<CefRequest> request,
+        bool is_navigation,
+        bool is_download,
+        const CefString& request_initiator,
+        bool& disable_default_handling) override;
+
+    // 文档开始脚本（按浏览器角色），每次主框架上下文创建时在渲染进程执行
+    // 已创建的浏览器从下一次导航/刷新开始生效
+    void SetStartupScript(const QString& role, const std::string& script);
+    // 在脚本之前执行的前置数据（关键词自动机等），只发这一小段，脚本本体不重发
+    // 换渲染进程后会在当前页面再执行一次，需要可以重复执行
+    void SetStartupPrelude(const std::string& prelude);
+    CefRefPtr<CefDictionaryValue> CreateExtraInfo(); // CreateBrowser 的 extra_info
+
+    // 资源拦截策略，需在创建浏览器之前设置
+    void SetResourcePolicy(const QString& label, const ResourcePolicy& policy);
+    CefRefPtr<ResourceFilter> GetResourceFilter() const { return m_resourceFilter; }
+
     // Browser access
     CefRefPtr<CefBrowser> GetBrowser() const { return m_browser; }
     bool IsClosing() const { return m_isClosing; }
+    qint64 RendererPid() const { return m_rendererPid; } // 0 表示尚未上报
 
     // Execute JavaScript
     void ExecuteJavaScript(const QString& code);
+    void ExecuteJavaScript(const std::string& code); // UTF-8，缓存脚本直接传入，免去转换
 
     // Set parent window for embedding
     void SetParentHwnd(HWND hwnd) { m_parentHwnd = hwnd; }
@@ -113,7 +146,7 @@ signals:
     void networkLogReceived(const QString& log);
 
     // X互关宝专用信号
-    void newPostsFound(const QString& jsonData);
+    void newPostsFound(const QJsonArray& posts);
     void followSuccess(const QString& userHandle);
     void alreadyFollowing(const QString& userHandle);
     void followFailed(const QString& userHandle);
@@ -127,16 +160,36 @@ signals:
     void unfollowSuccess(const QString& userHandle);
     void unfollowFailed(const QString& userHandle);
     // 粉丝采集信号
-    void newFollowersFound(const QString& jsonData);
+    void newFollowersFound(const QJsonArray& followers);
     // 登录状态信号
     void userLoggedIn();
     // 回关探测信号
-    void followBackDetected(const QString& jsonData);
+    void followBackDetected(const QJsonArray& followers);
+    // 粉丝快照：分批收到的 handle 列表，以及扫描结束（complete 为 false 表示列表没滚完）
+    void followerSnapshotReceived(const QJsonArray& handles);
+    void followerSnapshotDone(bool complete, int count);
+    // 抓到的时间线/用户列表接口响应（ResourcePolicy::captureApi），从 IO 线程排队到主线程
+    void apiResponseCaptured(const QString& operation, const QByteArray& body);
 
 private:
+    // xfollowing.emit(type, payload) 分发表：type -> 处理函数
+    using EmitHandler = std::function<void(CefRefPtr<CefValue>)>;
+    void registerEmitHandlers();
+    void dispatchEmit(const std::string& type, CefRefPtr<CefValue> payload);
+
+    std::unordered_map<std::string, EmitHandler> m_emitHandlers;
+
+    CefRefPtr<ResourceFilter> m_resourceFilter;
+
     CefRefPtr<CefBrowser> m_browser;
     std::list<CefRefPtr<CefBrowser>> m_browserList;
     bool m_isClosing;
+    qint64 m_rendererPid = 0;
+    std::string m_scriptRole;
+    std::string m_startupScript;
+    std::string m_startupPrelude;
+    bool m_startupScriptChanged = false; // 创建浏览器之后更新过（新渲染进程只有 extra_info 里的旧版本）
+    qint64 m_syncedRendererPid = 0;      // 已收到最新脚本的渲染进程
     HWND m_parentHwnd = nullptr;
 
     IMPLEMENT_REFCOUNTING(CefHandler);
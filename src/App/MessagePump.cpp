@@ -0,0 +1,178 @@
+#include "MessagePump.h"
+#include "Utils/Logger.h"
+#include "include/cef_app.h"
+#include <QDebug>
+#include <QMetaObject>
+#include <windows.h>
+
+std::atomic<MessagePump*> MessagePump::s_instance{nullptr};
+std::atomic<bool> MessagePump::s_immediateQueued{false};
+
+// 进程累计CPU时间（用户态+内核态，100ns 单位）
+static qint64 processCpuTime100ns() {
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime,
+                         &kernelTime, &userTime)) {
+        return 0;
+    }
+    ULARGE_INTEGER kernel, user;
+    kernel.LowPart = kernelTime.dwLowDateTime;
+    kernel.HighPart = kernelTime.dwHighDateTime;
+    user.LowPart = userTime.dwLowDateTime;
+    user.HighPart = userTime.dwHighDateTime;
+    return static_cast<qint64>(kernel.QuadPart + user.QuadPart);
+}
+
+MessagePump::MessagePump(QObject* parent)
+    : QObject(parent) {
+    m_workTimer.setSingleShot(true);
+    m_workTimer.setTimerType(Qt::PreciseTimer);
+    connect(&m_workTimer, &QTimer::timeout, this, [this]() {
+        if (m_heartbeatArmed) {
+            m_heartbeatWakeups++;
+        }
+        doWork();
+    });
+
+    m_statsTimer.setInterval(STATS_INTERVAL_MS);
+    connect(&m_statsTimer, &QTimer::timeout, this, &MessagePump::reportStats);
+    m_statsTimer.start();
+    m_statsClock.start();
+    m_lastCpuTime100ns = processCpuTime100ns();
+}
+
+MessagePump::~MessagePump() {
+}
+
+void MessagePump::start() {
+    if (s_instance.load()) {
+        return;
+    }
+    MessagePump* pump = new MessagePump();
+    s_instance.store(pump);
+    xfInfo(lcCef) << "CEF message pump started (on-demand scheduling)";
+
+    // 立即执行一次：补上 CefInitialize 期间请求过的工作，并启动兜底心跳
+    scheduleWork(0);
+}
+
+void MessagePump::stop() {
+    // CEF 的 IO/IPC 线程在 CefShutdown 之前还可能调用 scheduleWork，
+    // 这里只停止处理，对象留到 destroy() 再释放
+    MessagePump* pump = s_instance.load();
+    if (pump && !pump->m_stopped) {
+        pump->m_stopped = true;
+        pump->m_workTimer.stop();
+        pump->m_statsTimer.stop();
+        pump->reportStats();
+    }
+}
+
+void MessagePump::destroy() {
+    MessagePump* pump = s_instance.exchange(nullptr);
+    delete pump; // 排队中的 onScheduleWork 调用随对象一起丢弃
+}
+
+MessagePump* MessagePump::instance() {
+    return s_instance.load();
+}
+
+void MessagePump::scheduleWork(qint64 delayMs) {
+    MessagePump* pump = s_instance.load();
+    if (!pump) {
+        return; // 泵启动时会立即执行一次
+    }
+
+    // 立即执行的请求只需要排队一个，多余的合并掉
+    if (delayMs <= 0 && s_immediateQueued.exchange(true)) {
+        return;
+    }
+
+    // CEF 可能在任意线程调用，统一排队到主线程处理
+    Clock::time_point requestedAt = Clock::now();
+    QMetaObject::invokeMethod(
+        pump,
+        [pump, delayMs, requestedAt]() {
+            pump->onScheduleWork(delayMs, requestedAt);
+        },
+        Qt::QueuedConnection);
+}
+
+void MessagePump::onScheduleWork(qint64 delayMs,
+                                 Clock::time_point requestedAt) {
+    if (m_stopped) {
+        return;
+    }
+    if (delayMs <= 0) {
+        s_immediateQueued.store(false);
+        if (m_isActive) {
+            // CefDoMessageLoopWork 内部的嵌套事件循环，工作结束后再补一次
+            m_reentrancyDetected = true;
+            return;
+        }
+        double latencyMs =
+            std::chrono::duration<double, std::milli>(Clock::now() - requestedAt)
+                .count();
+        m_immediateWakeups++;
+        m_immediateLatencyMsSum += latencyMs;
+        m_immediateLatencyMsMax = qMax(m_immediateLatencyMsMax, latencyMs);
+        doWork();
+        return;
+    }
+
+    // 延迟执行：只在比当前定时器更早（或当前只是兜底心跳）时重设
+    int delay = static_cast<int>(qMin<qint64>(delayMs, MAX_TIMER_DELAY_MS));
+    if (!m_workTimer.isActive() || m_heartbeatArmed ||
+        m_workTimer.remainingTime() > delay) {
+        m_heartbeatArmed = false;
+        m_workTimer.start(delay);
+    }
+}
+
+void MessagePump::doWork() {
+    m_workTimer.stop();
+    m_heartbeatArmed = false;
+
+    m_isActive = true;
+    CefDoMessageLoopWork();
+    m_isActive = false;
+    m_wakeups++;
+
+    if (m_reentrancyDetected) {
+        m_reentrancyDetected = false;
+        scheduleWork(0);
+    } else if (!m_workTimer.isActive()) {
+        // 工作期间发出的调度请求还在队列里，会替换掉这个心跳
+        m_heartbeatArmed = true;
+        m_workTimer.start(IDLE_HEARTBEAT_MS);
+    }
+}
+
+void MessagePump::reportStats() {
+    double seconds = m_statsClock.restart() / 1000.0;
+    qint64 cpuTime = processCpuTime100ns();
+    double cpuSeconds = (cpuTime - m_lastCpuTime100ns) / 1e7;
+    m_lastCpuTime100ns = cpuTime;
+    if (seconds <= 0.0) {
+        return;
+    }
+
+    double avgLatency = m_immediateWakeups > 0
+                            ? m_immediateLatencyMsSum / m_immediateWakeups
+                            : 0.0;
+    xfInfo(lcCef).noquote()
+        << QString("[PUMP] wakeups=%1/s (immediate=%2 heartbeat=%3) "
+                   "latency avg=%4ms max=%5ms mainProcessCpu=%6%")
+               .arg(m_wakeups / seconds, 0, 'f', 1)
+               .arg(m_immediateWakeups)
+               .arg(m_heartbeatWakeups)
+               .arg(avgLatency, 0, 'f', 2)
+               .arg(m_immediateLatencyMsMax, 0, 'f', 2)
+               .arg(cpuSeconds * 100.0 / seconds, 0, 'f', 2);
+
+    m_wakeups = 0;
+    m_immediateWakeups = 0;
+    m_heartbeatWakeups = 0;
+    m_immediateLatencyMsSum = 0.0;
+    m_immediateLatencyMsMax = 0.0;
+}
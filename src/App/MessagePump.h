@@ -0,0 +1,65 @@
+#ifndef MESSAGEPUMP_H
+#define MESSAGEPUMP_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+#include <atomic>
+#include <chrono>
+
+// CEF 外部消息泵（external_message_pump = true）
+// CEF 通过 BrowserApp::OnScheduleMessagePumpWork(delay_ms) 告知何时需要处理工作，
+// 这里把请求转到 Qt 事件循环上执行 CefDoMessageLoopWork：
+//   - delay_ms <= 0：投递一个排队事件，尽快执行
+//   - delay_ms > 0：单次定时器，延迟上限 MAX_TIMER_DELAY_MS
+//   - 没有任何请求时，用低频心跳兜底（CEF 少数内部任务不会发出调度请求）
+// 取代原来固定 10ms 的轮询定时器，空闲时唤醒次数大幅减少
+class MessagePump : public QObject {
+    Q_OBJECT
+
+public:
+    // 在 QApplication 创建之后调用；启动时总会立即执行一次，
+    // CefInitialize 期间（泵还不存在时）的调度请求直接忽略
+    static void start();
+    static void stop();    // CefShutdown 之前：停止处理调度请求
+    static void destroy(); // CefShutdown 返回之后：CEF 线程已退出，释放对象
+    static MessagePump* instance();
+
+    // 任意线程调用
+    static void scheduleWork(qint64 delayMs);
+
+    static const int MAX_TIMER_DELAY_MS = 1000 / 30; // CEF 请求延迟上限（约33ms）
+    static const int IDLE_HEARTBEAT_MS = 250;        // 空闲兜底心跳
+    static const int STATS_INTERVAL_MS = 60000;      // 统计输出间隔
+
+private:
+    explicit MessagePump(QObject* parent = nullptr);
+    ~MessagePump();
+
+    using Clock = std::chrono::steady_clock;
+
+    void onScheduleWork(qint64 delayMs, Clock::time_point requestedAt);
+    void doWork();
+    void reportStats();
+
+    QTimer m_workTimer;  // 延迟工作（单次）
+    QTimer m_statsTimer; // 统计输出
+    bool m_stopped = false;        // 已 stop()，不再执行 CefDoMessageLoopWork
+    bool m_isActive = false;       // 正在 CefDoMessageLoopWork 中（防止重入）
+    bool m_reentrancyDetected = false;
+    bool m_heartbeatArmed = false; // m_workTimer 当前是兜底心跳
+
+    // 唤醒统计（用于对比空闲CPU与事件延迟）
+    quint64 m_wakeups = 0;
+    quint64 m_immediateWakeups = 0;
+    quint64 m_heartbeatWakeups = 0;
+    double m_immediateLatencyMsSum = 0.0;
+    double m_immediateLatencyMsMax = 0.0;
+    QElapsedTimer m_statsClock;
+    qint64 m_lastCpuTime100ns = 0;
+
+    static std::atomic<MessagePump*> s_instance;
+    static std::atomic<bool> s_immediateQueued; // 已有立即执行请求在排队（合并）
+};
+
+#endif // MESSAGEPUMP_H
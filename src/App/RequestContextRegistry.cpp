@@ -0,0 +1,82 @@
+#include "RequestContextRegistry.h"
+#include "Utils/Logger.h"
+#include "include/cef_cookie.h"
+#include <QDir>
+
+QHash<QString, RequestContextRegistry::Entry> RequestContextRegistry::s_entries;
+
+QString RequestContextRegistry::keyFor(const QString& profilePath) {
+    // Windows 路径不区分大小写，统一成绝对路径后小写作为键
+    return QDir::cleanPath(QDir(profilePath).absolutePath()).toLower();
+}
+
+CefRefPtr<CefRequestContext> RequestContextRegistry::acquire(const QString& profilePath) {
+    if (profilePath.isEmpty()) {
+        return nullptr;
+    }
+
+    QString key = keyFor(profilePath);
+    auto it = s_entries.find(key);
+    if (it != s_entries.end()) {
+        it->refs++;
+        xfDebug(lcCef) << "Reuse request context" << Logger::kv("profile", profilePath)
+                       << Logger::kv("refs", it->refs);
+        return it->context;
+    }
+
+    QDir profileDir(profilePath);
+    if (!profileDir.exists()) {
+        profileDir.mkpath(".");
+    }
+    QString absolutePath = QDir::toNativeSeparators(profileDir.absolutePath());
+
+    CefRequestContextSettings contextSettings;
+    CefString(&contextSettings.cache_path).FromWString(absolutePath.toStdWString());
+    contextSettings.persist_session_cookies = true;
+
+    Entry entry;
+    entry.context = CefRequestContext::CreateContext(contextSettings, nullptr);
+    entry.refs = 1;
+    s_entries.insert(key, entry);
+    xfInfo(lcCef) << "Created request context" << Logger::kv("profile", absolutePath)
+                  << Logger::kv("contexts", s_entries.size());
+    return entry.context;
+}
+
+void RequestContextRegistry::release(const QString& profilePath) {
+    if (profilePath.isEmpty()) {
+        return;
+    }
+
+    auto it = s_entries.find(keyFor(profilePath));
+    if (it == s_entries.end()) {
+        return;
+    }
+    if (--it->refs > 0) {
+        return;
+    }
+
+    // 最后一个使用者：把会话 Cookie 写盘后释放（CEF 在浏览器全部关闭后销毁上下文）
+    CefRefPtr<CefCookieManager> manager = it->context->GetCookieManager(nullptr);
+    if (manager) {
+        manager->FlushStore(nullptr);
+    }
+    s_entries.erase(it);
+    xfInfo(lcCef) << "Released request context" << Logger::kv("profile", profilePath)
+                  << Logger::kv("contexts", s_entries.size());
+}
+
+int RequestContextRegistry::refCount(const QString& profilePath) {
+    auto it = s_entries.constFind(keyFor(profilePath));
+    return it == s_entries.constEnd() ? 0 : it->refs;
+}
+
+void RequestContextRegistry::clear() {
+    for (auto it = s_entries.begin(); it != s_entries.end(); ++it) {
+        CefRefPtr<CefCookieManager> manager = it->context->GetCookieManager(nullptr);
+        if (manager) {
+            manager->FlushStore(nullptr);
+        }
+    }
+    s_entries.clear();
+}
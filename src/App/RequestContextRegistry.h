@@ -0,0 +1,36 @@
+#ifndef REQUESTCONTEXTREGISTRY_H
+#define REQUESTCONTEXTREGISTRY_H
+
+#include "include/cef_request_context.h"
+#include <QHash>
+#include <QString>
+
+// 进程内按 profile 路径共享 CefRequestContext
+// 搜索、粉丝采集、回关探测浏览器都使用扫描账号的 profile，
+// 共用一个上下文即可共享网络会话、Cookie 和内存缓存，避免同一缓存目录被多个上下文同时打开
+// 引用计数：acquire/release 成对调用；计数归零时刷写 Cookie 并释放上下文
+// 只在主线程使用
+class RequestContextRegistry {
+public:
+    // profilePath 为空时返回 nullptr（使用全局上下文）
+    static CefRefPtr<CefRequestContext> acquire(const QString& profilePath);
+    static void release(const QString& profilePath);
+
+    // CefShutdown 之前调用，释放所有上下文
+    static void clear();
+
+    static int contextCount() { return s_entries.size(); }
+    static int refCount(const QString& profilePath);
+
+private:
+    struct Entry {
+        CefRefPtr<CefRequestContext> context;
+        int refs = 0;
+    };
+
+    static QString keyFor(const QString& profilePath);
+
+    static QHash<QString, Entry> s_entries;
+};
+
+#endif // REQUESTCONTEXTREGISTRY_H
@@ -0,0 +1,222 @@
+#include "ResourcePolicy.h"
+#include "Utils/Logger.h"
+#include <QStringList>
+
+namespace {
+
+// 统计/广告上报端点（子串匹配）
+const char* const kTrackingPatterns[] = {
+    "/i/api/1.1/jot/",   // X 客户端事件上报
+    "/1.1/jot/",
+    "ads-twitter.com",
+    "ads-api.x.com",
+    "ads-api.twitter.com",
+    "analytics.twitter.com",
+    "google-analytics.com",
+    "googletagmanager.com",
+    "doubleclick.net",
+};
+
+const char* const kCategoryNames[] = {"image", "media", "font", "tracking"};
+
+// 未观测到实际大小时使用的单个请求平均字节数
+const quint64 kPriorBytes[] = {
+    25 * 1024,  // 头像/配图缩略图
+    400 * 1024, // 视频分片、GIF
+    30 * 1024,  // woff2
+    1024,       // 上报请求
+};
+
+// 进程内所有浏览器放行请求的实际大小（用户浏览器不拦截，可作为估算依据）
+std::atomic<quint64> s_observedBytes[ResourceFilter::CategoryCount];
+std::atomic<quint64> s_observedCount[ResourceFilter::CategoryCount];
+
+qint64 steadySeconds() {
+    return std::chrono::duration_cast<std::chrono::seconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// 请求所属分类，-1 表示不在任何可拦截分类中
+int categoryOf(cef_resource_type_t type, bool tracking) {
+    switch (type) {
+        case RT_MAIN_FRAME:
+        case RT_SUB_FRAME:
+            return -1; // 页面本身永不拦截
+        case RT_IMAGE:
+        case RT_FAVICON:
+            return ResourceFilter::Image;
+        case RT_MEDIA:
+            return ResourceFilter::Media;
+        case RT_FONT_RESOURCE:
+            return ResourceFilter::Font;
+        default:
+            return tracking ? ResourceFilter::Tracking : -1;
+    }
+}
+
+} // namespace
+
+ResourcePolicy ResourcePolicy::scanner() {
+    ResourcePolicy policy;
+    policy.blockImages = true;
+    policy.blockMedia = true;
+    policy.blockFonts = true;
+    policy.blockTracking = true;
+    return policy;
+}
+
+ResourceFilter::ResourceFilter(const QString& label, const ResourcePolicy& policy)
+    : m_label(label)
+    , m_policy(policy) {
+    for (auto& counter : m_blocked) {
+        counter.store(0);
+    }
+    m_lastStatsAt.store(steadySeconds());
+}
+
+bool ResourceFilter::isTrackingUrl(const std::string& url) {
+    for (const char* pattern : kTrackingPatterns) {
+        if (url.find(pattern) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int ResourceFilter::classify(cef_resource_type_t type, const std::string& url) const {
+    int category = categoryOf(type, m_policy.blockTracking && isTrackingUrl(url));
+    switch (category) {
+        case Image:
+            return m_policy.blockImages ? category : -1;
+        case Media:
+            return m_policy.blockMedia ? category : -1;
+        case Font:
+            return m_policy.blockFonts ? category : -1;
+        case Tracking:
+            return category;
+        default:
+            return -1;
+    }
+}
+
+CefResourceRequestHandler::ReturnValue ResourceFilter::OnBeforeResourceLoad(
+    CefRefPtr<CefBrowser> browser,
+    CefRefPtr<CefFrame> frame,
+    CefRefPtr<CefRequest> request,
+    CefRefPtr<CefCallback> callback) {
+    if (!m_policy.blocksAnything()) {
+        return RV_CONTINUE;
+    }
+
+    int category = classify(request->GetResourceType(), request->GetURL().ToString());
+
+    // IO 线程上按间隔输出统计，不需要额外的定时器
+    qint64 now = steadySeconds();
+    qint64 last = m_lastStatsAt.load();
+    if (now - last >= STATS_INTERVAL_SECS && m_lastStatsAt.compare_exchange_strong(last, now)) {
+        logStats();
+    }
+
+    if (category < 0) {
+        m_allowed++;
+        return RV_CONTINUE;
+    }
+    m_blocked[category]++;
+    return RV_CANCEL;
+}
+
+void ResourceFilter::setCaptureSink(CaptureSink sink) {
+    std::lock_guard<std::mutex> lock(m_captureMutex);
+    m_captureSink = std::move(sink);
+}
+
+CefRefPtr<CefResponseFilter> ResourceFilter::GetResourceResponseFilter(
+    CefRefPtr<CefBrowser> browser,
+    CefRefPtr<CefFrame> frame,
+    CefRefPtr<CefRequest> request,
+    CefRefPtr<CefResponse> response) {
+    if (!m_policy.captureApi || response->GetStatus() != 200 ||
+        response->GetMimeType().ToString().find("json") == std::string::npos) {
+        return nullptr;
+    }
+    std::string operation = ResponseCapture::operationOf(request->GetURL().ToString());
+    if (operation.empty()) {
+        return nullptr;
+    }
+    CefRefPtr<TeeResponseFilter> filter = new TeeResponseFilter(operation);
+    std::lock_guard<std::mutex> lock(m_captureMutex);
+    m_captures[request->GetIdentifier()] = filter;
+    return filter;
+}
+
+void ResourceFilter::OnResourceLoadComplete(CefRefPtr<CefBrowser> browser,
+                                            CefRefPtr<CefFrame> frame,
+                                            CefRefPtr<CefRequest> request,
+                                            CefRefPtr<CefResponse> response,
+                                            URLRequestStatus status,
+                                            int64_t received_content_length) {
+    if (m_policy.captureApi) {
+        CefRefPtr<TeeResponseFilter> capture;
+        CaptureSink sink;
+        {
+            std::lock_guard<std::mutex> lock(m_captureMutex);
+            auto it = m_captures.find(request->GetIdentifier());
+            if (it != m_captures.end()) {
+                capture = it->second;
+                m_captures.erase(it);
+                sink = m_captureSink;
+            }
+        }
+        if (capture && sink && status == UR_SUCCESS && !capture->truncated()) {
+            sink(capture->operation(), capture->takeBody());
+        }
+    }
+
+    if (status != UR_SUCCESS || received_content_length <= 0) {
+        return;
+    }
+    m_bytesLoaded += static_cast<quint64>(received_content_length);
+
+    std::string url = request->GetURL().ToString();
+    int category = categoryOf(request->GetResourceType(), isTrackingUrl(url));
+    if (category >= 0) {
+        s_observedBytes[category] += static_cast<quint64>(received_content_length);
+        s_observedCount[category]++;
+    }
+}
+
+quint64 ResourceFilter::blockedTotal() const {
+    quint64 total = 0;
+    for (const auto& counter : m_blocked) {
+        total += counter.load();
+    }
+    return total;
+}
+
+quint64 ResourceFilter::bytesSavedEstimate() const {
+    quint64 saved = 0;
+    for (int i = 0; i < CategoryCount; ++i) {
+        quint64 count = s_observedCount[i].load();
+        quint64 average = count > 0 ? s_observedBytes[i].load() / count : kPriorBytes[i];
+        saved += m_blocked[i].load() * average;
+    }
+    return saved;
+}
+
+void ResourceFilter::logStats() const {
+    if (!m_policy.blocksAnything()) {
+        return;
+    }
+    QStringList parts;
+    for (int i = 0; i < CategoryCount; ++i) {
+        parts << QString("%1=%2").arg(kCategoryNames[i]).arg(m_blocked[i].load());
+    }
+    xfInfo(lcCef).noquote() << QString("[RESOURCE] %1 blocked=%2 (%3) allowed=%4 loaded=%5KB savedEstimate=%6KB")
+                                   .arg(m_label)
+                                   .arg(blockedTotal())
+                                   .arg(parts.join(' '))
+                                   .arg(m_allowed.load())
+                                   .arg(m_bytesLoaded.load() / 1024)
+                                   .arg(bytesSavedEstimate() / 1024);
+}
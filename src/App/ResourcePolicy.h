@@ -0,0 +1,99 @@
+#ifndef RESOURCEPOLICY_H
+#define RESOURCEPOLICY_H
+
+#include "include/cef_resource_request_handler.h"
+#include "ResponseCapture.h"
+#include <QString>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+// 浏览器资源加载策略
+// 扫描类浏览器（搜索/粉丝采集/回关探测）只读取 DOM 文本和 data-testid，
+// 头像、配图、视频、字体和统计上报请求都可以直接取消；用户浏览器不做任何拦截
+struct ResourcePolicy {
+    bool blockImages = false;   // RT_IMAGE / RT_FAVICON
+    bool blockMedia = false;    // RT_MEDIA（视频、GIF）
+    bool blockFonts = false;    // RT_FONT_RESOURCE
+    bool blockTracking = false; // 统计/广告上报端点
+    bool captureApi = false;    // 抓取时间线/用户列表接口响应（ResponseCapture）
+
+    static ResourcePolicy allowAll() { return ResourcePolicy(); }
+    static ResourcePolicy scanner();
+
+    bool blocksAnything() const {
+        return blockImages || blockMedia || blockFonts || blockTracking;
+    }
+};
+
+// 按策略取消请求，并统计拦截数和估算节省的流量
+// GetResourceRequestHandler / OnBeforeResourceLoad 在 IO 线程调用，计数器均为原子量
+class ResourceFilter : public CefResourceRequestHandler {
+public:
+    enum Category {
+        Image = 0,
+        Media,
+        Font,
+        Tracking,
+        CategoryCount
+    };
+
+    ResourceFilter(const QString& label, const ResourcePolicy& policy);
+
+    const ResourcePolicy& policy() const { return m_policy; }
+
+    // 抓到的接口响应（操作名, 响应体），在 IO 线程调用；传空函数解除
+    using CaptureSink = std::function<void(const std::string&, std::string)>;
+    void setCaptureSink(CaptureSink sink);
+
+    // CefResourceRequestHandler methods
+    ReturnValue OnBeforeResourceLoad(CefRefPtr<CefBrowser> browser,
+                                     CefRefPtr<CefFrame> frame,
+                                     CefRefPtr<CefRequest> request,
+                                     CefRefPtr<CefCallback> callback) override;
+    CefRefPtr<CefResponseFilter> GetResourceResponseFilter(CefRefPtr<CefBrowser> browser,
+                                                           CefRefPtr<CefFrame> frame,
+                                                           CefRefPtr<CefRequest> request,
+                                                           CefRefPtr<CefResponse> response) override;
+    void OnResourceLoadComplete(CefRefPtr<CefBrowser> browser,
+                                CefRefPtr<CefFrame> frame,
+                                CefRefPtr<CefRequest> request,
+                                CefRefPtr<CefResponse> response,
+                                URLRequestStatus status,
+                                int64_t received_content_length) override;
+
+    quint64 blockedCount(Category category) const { return m_blocked[category].load(); }
+    quint64 blockedTotal() const;
+    quint64 bytesSavedEstimate() const;
+    quint64 bytesLoaded() const { return m_bytesLoaded.load(); }
+
+    // 写一行统计（浏览器关闭时、以及 IO 线程上每 STATS_INTERVAL_SECS 一次）
+    void logStats() const;
+
+    static const int STATS_INTERVAL_SECS = 300;
+
+private:
+    // 返回应拦截的分类，-1 表示放行
+    int classify(cef_resource_type_t type, const std::string& url) const;
+    static bool isTrackingUrl(const std::string& url);
+
+    const QString m_label;
+    const ResourcePolicy m_policy;
+
+    std::atomic<quint64> m_blocked[CategoryCount];
+    std::atomic<quint64> m_allowed{0};
+    std::atomic<quint64> m_bytesLoaded{0};
+    std::atomic<qint64> m_lastStatsAt{0}; // steady_clock 秒
+
+    std::mutex m_captureMutex;
+    CaptureSink m_captureSink;
+    std::map<uint64_t, CefRefPtr<TeeResponseFilter>> m_captures; // 请求ID -> 进行中的抓取
+
+    IMPLEMENT_REFCOUNTING(ResourceFilter);
+    DISALLOW_COPY_AND_ASSIGN(ResourceFilter);
+};
+
+#endif // RESOURCEPOLICY_H
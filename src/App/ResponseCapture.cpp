@@ -0,0 +1,66 @@
+#include "ResponseCapture.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// 搜索结果、粉丝列表、蓝V粉丝列表
+const char* const kCapturedOperations[] = {
+    "SearchTimeline",
+    "Followers",
+    "BlueVerifiedFollowers",
+};
+
+} // namespace
+
+namespace ResponseCapture {
+
+std::string operationOf(const std::string& url) {
+    const std::string marker = "/i/api/graphql/";
+    size_t pos = url.find(marker);
+    if (pos == std::string::npos) {
+        return std::string();
+    }
+    // <hash>/<操作名>?variables=...
+    size_t hashEnd = url.find('/', pos + marker.size());
+    if (hashEnd == std::string::npos) {
+        return std::string();
+    }
+    size_t nameEnd = url.find_first_of("?#", hashEnd + 1);
+    std::string name = url.substr(hashEnd + 1, nameEnd == std::string::npos
+                                                   ? std::string::npos
+                                                   : nameEnd - hashEnd - 1);
+    for (const char* operation : kCapturedOperations) {
+        if (name == operation) {
+            return name;
+        }
+    }
+    return std::string();
+}
+
+} // namespace ResponseCapture
+
+CefResponseFilter::FilterStatus TeeResponseFilter::Filter(void* data_in,
+                                                          size_t data_in_size,
+                                                          size_t& data_in_read,
+                                                          void* data_out,
+                                                          size_t data_out_size,
+                                                          size_t& data_out_written) {
+    // 输出缓冲区放不下时只读一部分，剩余的输入下一次再传进来
+    size_t count = std::min(data_in_size, data_out_size);
+    if (count > 0) {
+        memcpy(data_out, data_in, count);
+        if (!m_truncated) {
+            if (m_body.size() + count > ResponseCapture::kMaxBodyBytes) {
+                m_truncated = true;
+                m_body.clear();
+                m_body.shrink_to_fit();
+            } else {
+                m_body.append(static_cast<const char*>(data_in), count);
+            }
+        }
+    }
+    data_in_read = count;
+    data_out_written = count;
+    return count < data_in_size ? RESPONSE_FILTER_NEED_MORE_DATA : RESPONSE_FILTER_DONE;
+}
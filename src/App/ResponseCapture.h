@@ -0,0 +1,47 @@
+#ifndef RESPONSECAPTURE_H
+#define RESPONSECAPTURE_H
+
+#include "include/cef_response_filter.h"
+#include <cstdint>
+#include <string>
+
+// 时间线接口响应抓取（IO 线程）
+// 扫描类浏览器加载的 GraphQL 时间线/用户列表 JSON 原样转发给页面，同时复制一份，
+// 加载完成后交给 C++ 解析（TimelineParser），不必等页面渲染再从 DOM 读取
+namespace ResponseCapture {
+
+// 需要抓取的 GraphQL 操作名（/i/api/graphql/<hash>/<操作名>），不抓取时返回空串
+std::string operationOf(const std::string& url);
+
+// 单个响应的大小上限，超出时放弃抓取（页面照常接收）
+const size_t kMaxBodyBytes = 4 * 1024 * 1024;
+
+} // namespace ResponseCapture
+
+// 透传过滤器：输出与输入完全相同，输入同时追加到 body()
+class TeeResponseFilter : public CefResponseFilter {
+public:
+    explicit TeeResponseFilter(const std::string& operation) : m_operation(operation) {}
+
+    bool InitFilter() override { return true; }
+    FilterStatus Filter(void* data_in,
+                        size_t data_in_size,
+                        size_t& data_in_read,
+                        void* data_out,
+                        size_t data_out_size,
+                        size_t& data_out_written) override;
+
+    const std::string& operation() const { return m_operation; }
+    std::string takeBody() { return std::move(m_body); }
+    bool truncated() const { return m_truncated; }
+
+private:
+    const std::string m_operation;
+    std::string m_body;
+    bool m_truncated = false;
+
+    IMPLEMENT_REFCOUNTING(TeeResponseFilter);
+    DISALLOW_COPY_AND_ASSIGN(TeeResponseFilter);
+};
+
+#endif // RESPONSECAPTURE_H
@@ -3,6 +3,7 @@
 
 #include <QObject>
 #include <QString>
+#include <string>
 
 class AutoFollower : public QObject {
     Q_OBJECT
@@ -11,13 +12,19 @@ public:
     explicit AutoFollower(QObject* parent = nullptr);
 
     // 获取关注脚本
-    QString getFollowScript();
+    const std::string& getFollowScript();
 
     // 获取回关检查脚本（检查对方是否关注我）
-    QString getCheckFollowBackScript();
+    const std::string& getCheckFollowBackScript();
 
     // 获取取消关注脚本
-    QString getUnfollowScript();
+    const std::string& getUnfollowScript();
+
+private:
+    // 页面脚本前拼接就绪等待模块，首次使用时拼接并缓存
+    std::string m_followScript;
+    std::string m_checkFollowBackScript;
+    std::string m_unfollowScript;
 };
 
 #endif // AUTOFOLLOWER_H
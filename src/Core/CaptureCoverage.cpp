@@ -0,0 +1,82 @@
+#include "CaptureCoverage.h"
+#include "Utils/Logger.h"
+
+void CaptureCoverage::noteResponse(qint64 bytes, qint64 parseUs, int posts,
+                                   int users) {
+  m_responses++;
+  m_bytes += bytes;
+  m_parseUsTotal += parseUs;
+  m_parseUsMax = qMax(m_parseUsMax, parseUs);
+  m_posts += posts;
+  m_users += users;
+}
+
+void CaptureCoverage::noteCaptured(const QStringList &ids, qint64 nowMs) {
+  for (const auto &id : ids) {
+    QString key = id.toLower();
+    if (!m_capturedAt.contains(key)) {
+      m_capturedAt.insert(key, nowMs);
+    }
+  }
+}
+
+void CaptureCoverage::noteDom(const QStringList &ids, qint64 nowMs) {
+  for (const auto &id : ids) {
+    m_domItems++;
+    auto it = m_capturedAt.constFind(id.toLower());
+    if (it != m_capturedAt.constEnd()) {
+      m_covered++;
+      m_leadMsTotal += nowMs - it.value();
+    }
+  }
+}
+
+void CaptureCoverage::reportIfDue(qint64 nowMs) {
+  if (m_lastReportMs == 0) {
+    m_lastReportMs = nowMs;
+    return;
+  }
+  if (nowMs - m_lastReportMs >= qint64(REPORT_INTERVAL_SECS) * 1000) {
+    report(nowMs);
+  }
+}
+
+void CaptureCoverage::report(qint64 nowMs) {
+  m_lastReportMs = nowMs;
+  if (m_responses == 0 && m_domItems == 0) {
+    return;
+  }
+
+  // coverage: DOM 上报的条目里抓取也拿到的比例；leadMs: 抓取比 DOM 早多少
+  xfInfo(lcMonitor).noquote()
+      << "[CAPTURE]" << m_role << Logger::kv("responses", m_responses)
+      << Logger::kv("kb", m_bytes / 1024)
+      << Logger::kv("parseAvgUs",
+                    m_responses > 0 ? m_parseUsTotal / m_responses : 0)
+      << Logger::kv("parseMaxUs", m_parseUsMax) << Logger::kv("posts", m_posts)
+      << Logger::kv("users", m_users) << Logger::kv("domItems", m_domItems)
+      << Logger::kv("covered", m_covered)
+      << Logger::kv("domOnly", m_domItems - m_covered)
+      << Logger::kv("leadAvgMs",
+                    m_covered > 0 ? m_leadMsTotal / m_covered : 0);
+
+  m_responses = 0;
+  m_bytes = 0;
+  m_parseUsTotal = 0;
+  m_parseUsMax = 0;
+  m_posts = 0;
+  m_users = 0;
+  m_domItems = 0;
+  m_covered = 0;
+  m_leadMsTotal = 0;
+
+  // 太旧的抓取记录不再用于对照
+  qint64 cutoff = nowMs - qint64(RETAIN_SECS) * 1000;
+  for (auto it = m_capturedAt.begin(); it != m_capturedAt.end();) {
+    if (it.value() < cutoff) {
+      it = m_capturedAt.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
@@ -0,0 +1,44 @@
+#ifndef CAPTURECOVERAGE_H
+#define CAPTURECOVERAGE_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+// 接口抓取 vs DOM 提取的对照统计（每个扫描浏览器一份）
+// 记录每个抓到的响应的大小、解析耗时和条目数；DOM 路径上报的每个条目
+// 查一下抓取是否已经见过、提前了多少毫秒。
+// 每 REPORT_INTERVAL_SECS 输出一行 [CAPTURE]，然后计数清零
+class CaptureCoverage {
+public:
+  explicit CaptureCoverage(const QString &role = QString()) : m_role(role) {}
+
+  void noteResponse(qint64 bytes, qint64 parseUs, int posts, int users);
+  void noteCaptured(const QStringList &ids, qint64 nowMs);
+  void noteDom(const QStringList &ids, qint64 nowMs);
+
+  void reportIfDue(qint64 nowMs);
+  void report(qint64 nowMs);
+
+  static const int REPORT_INTERVAL_SECS = 300;
+  static const int RETAIN_SECS = 1800; // 抓到的 ID 保留多久用于对照
+
+private:
+  QString m_role;
+  QHash<QString, qint64> m_capturedAt; // 小写 ID -> 第一次抓到的时间
+
+  int m_responses = 0;
+  qint64 m_bytes = 0;
+  qint64 m_parseUsTotal = 0;
+  qint64 m_parseUsMax = 0;
+  int m_posts = 0;
+  int m_users = 0;
+
+  int m_domItems = 0; // DOM 上报的条目
+  int m_covered = 0;  // 其中抓取已经见过的
+  qint64 m_leadMsTotal = 0;
+
+  qint64 m_lastReportMs = 0;
+};
+
+#endif // CAPTURECOVERAGE_H
@@ -1,4 +1,5 @@
 #include "DingTalkNotifier.h"
+#include "Utils/Logger.h"
 #include <QCryptographicHash>
 #include <QDateTime>
 #include <QJsonDocument>
@@ -58,15 +59,15 @@ void DingTalkNotifier::sendText(const QString &content) {
       QJsonDocument doc = QJsonDocument::fromJson(data);
       int errcode = doc.object()["errcode"].toInt(-1);
       if (errcode == 0) {
-        qDebug() << "[DingTalk] Send success";
+        xfInfo(lcNotify) << "[DingTalk] Send success";
         emit sendSuccess();
       } else {
         QString errmsg = doc.object()["errmsg"].toString();
-        qDebug() << "[DingTalk] API error:" << errcode << errmsg;
+        xfWarning(lcNotify) << "[DingTalk] API error:" << errcode << errmsg;
         emit sendFailed(errmsg);
       }
     } else {
-      qDebug() << "[DingTalk] Network error:" << reply->errorString();
+      xfWarning(lcNotify) << "[DingTalk] Network error:" << reply->errorString();
       emit sendFailed(reply->errorString());
     }
   });
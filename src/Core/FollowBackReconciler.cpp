@@ -0,0 +1,110 @@
+#include "FollowBackReconciler.h"
+#include "Utils/Logger.h"
+
+FollowBackReconciler::FollowBackReconciler(QObject *parent)
+    : QObject(parent), m_scanning(false),
+      m_refreshMinutes(DEFAULT_REFRESH_MINUTES) {}
+
+void FollowBackReconciler::loadState(const QJsonObject &state) {
+  if (!state.isEmpty() && !m_snapshot.fromJson(state)) {
+    xfWarning(lcFollow) << "Follower snapshot version mismatch, starting empty"
+                        << Logger::kv("version", state["version"].toInt());
+    return;
+  }
+  xfInfo(lcFollow) << "Follower snapshot loaded"
+                   << Logger::kv("followers", m_snapshot.size())
+                   << Logger::kv("complete",
+                                 m_snapshot.completeTime().toString(Qt::ISODate));
+}
+
+void FollowBackReconciler::setRefreshMinutes(int minutes) {
+  m_refreshMinutes = qMax(10, minutes);
+}
+
+bool FollowBackReconciler::isSnapshotDue(const QDateTime &now) const {
+  if (m_scanning) {
+    return false;
+  }
+  QDateTime completeTime = m_snapshot.completeTime();
+  return !completeTime.isValid() ||
+         completeTime.secsTo(now) >= qint64(m_refreshMinutes) * 60;
+}
+
+bool FollowBackReconciler::isSnapshotUsable(const QDateTime &now) const {
+  QDateTime completeTime = m_snapshot.completeTime();
+  return completeTime.isValid() && !m_snapshot.isEmpty() &&
+         completeTime.secsTo(now) <= qint64(m_refreshMinutes) * 2 * 60;
+}
+
+void FollowBackReconciler::beginScan(const QDateTime &now) {
+  m_scanning = true;
+  m_scanStartedAt = now;
+  m_scanHandles.clear();
+  xfInfo(lcFollow) << "Follower snapshot scan started";
+}
+
+void FollowBackReconciler::addScanHandles(const QJsonArray &handles) {
+  if (!m_scanning) {
+    return;
+  }
+  for (const auto &v : handles) {
+    QString handle = v.toString();
+    if (!handle.isEmpty()) {
+      m_scanHandles.append(handle);
+    }
+  }
+}
+
+void FollowBackReconciler::finishScan(bool complete, const QDateTime &now) {
+  if (!m_scanning) {
+    return;
+  }
+  m_scanning = false;
+  if (!complete || m_scanHandles.isEmpty()) {
+    xfWarning(lcFollow) << "Follower snapshot incomplete, keeping previous"
+                        << Logger::kv("seen", m_scanHandles.size())
+                        << Logger::kv("previous", m_snapshot.size());
+    m_scanHandles.clear();
+    return;
+  }
+
+  bool hadBaseline = m_snapshot.completeTime().isValid();
+  FollowerSnapshot::Diff diff = m_snapshot.replace(m_scanHandles, now);
+  m_scanHandles.clear();
+  xfInfo(lcFollow) << "Follower snapshot updated"
+                   << Logger::kv("followers", m_snapshot.size())
+                   << Logger::kv("gained", diff.added.size())
+                   << Logger::kv("lost", diff.lost.size())
+                   << Logger::kv("scanSecs", m_scanStartedAt.secsTo(now));
+
+  // 没有基线时，快照里原有的只是顶部一屏，差异没有意义
+  if (!hadBaseline) {
+    return;
+  }
+  if (!diff.added.isEmpty()) {
+    emit followersGained(diff.added);
+  }
+  if (!diff.lost.isEmpty()) {
+    emit followersLost(diff.lost);
+  }
+}
+
+QStringList FollowBackReconciler::observeFollowers(const QStringList &handles,
+                                                   const QDateTime &now) {
+  // 扫描期间只收进本次扫描，扫描完成时 replace() 才能得到真正的新增
+  if (m_scanning) {
+    m_scanHandles.append(handles);
+    return QStringList();
+  }
+  QStringList added = m_snapshot.merge(handles, now).added;
+  // 还没有完整基线时，快照里没有的不一定是新粉丝（升级后第一次加载探测页），
+  // 只归并不上报
+  if (!m_snapshot.completeTime().isValid()) {
+    return QStringList();
+  }
+  return added;
+}
+
+bool FollowBackReconciler::followsBack(const QString &handle) const {
+  return m_snapshot.contains(handle);
+}
@@ -0,0 +1,71 @@
+#ifndef FOLLOWBACKRECONCILER_H
+#define FOLLOWBACKRECONCILER_H
+
+#include "Data/FollowerSnapshot.h"
+#include <QDateTime>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+
+// 回关对账
+// 回关探测浏览器定期把自己的 verified_followers 列表完整滚动一遍，得到粉丝快照；
+// 快照新鲜且完整时，到期需要检查的已关注账号用一次集合查询判定是否回关，
+// 只有快照过期/不完整、或快照里没有的账号（需要取关，本来就要打开主页）才逐个加载主页。
+// 两次完整扫描之间，列表顶部新探测到的粉丝也并入快照；
+// 快照持久化，重启后探测页顶部的老粉丝不再被当成新回关重复上报
+class FollowBackReconciler : public QObject {
+  Q_OBJECT
+
+public:
+  explicit FollowBackReconciler(QObject *parent = nullptr);
+
+  // 持久化（follower_snapshot.json）
+  void loadState(const QJsonObject &state);
+  QJsonObject saveState() const { return m_snapshot.toJson(); }
+
+  // 快照刷新间隔（分钟）；超过两个间隔的快照视为过期，不再用于判定
+  void setRefreshMinutes(int minutes);
+  int refreshMinutes() const { return m_refreshMinutes; }
+
+  // 是否该重新扫描（没有进行中的扫描且快照已到刷新时间）
+  bool isSnapshotDue(const QDateTime &now) const;
+  // 快照可用于判定：完整且未过期
+  bool isSnapshotUsable(const QDateTime &now) const;
+  bool isScanning() const { return m_scanning; }
+  // 扫描开始时间，用于判断扫描是否卡住
+  QDateTime scanStartedAt() const { return m_scanStartedAt; }
+
+  void beginScan(const QDateTime &now);
+  void addScanHandles(const QJsonArray &handles);
+  // complete 为 false（未滚到底、未登录等）时丢弃本次结果，保留上一份快照
+  void finishScan(bool complete, const QDateTime &now);
+
+  // 探测页顶部可见的粉丝并入快照，返回快照里原来没有的（新粉丝）；
+  // 还没有完整基线时只归并、返回空，扫描期间只收进本次扫描
+  QStringList observeFollowers(const QStringList &handles,
+                               const QDateTime &now);
+
+  bool followsBack(const QString &handle) const;
+
+  int snapshotSize() const { return m_snapshot.size(); }
+  QDateTime snapshotTime() const { return m_snapshot.completeTime(); }
+
+  static const int DEFAULT_REFRESH_MINUTES = 120;
+  static const int MAX_SCAN_MINUTES = 40; // 超过则认为扫描中断
+
+signals:
+  // 完整扫描和上一份完整快照的差异（第一次完整扫描只建立基线，不发出）
+  void followersGained(const QStringList &handles);
+  void followersLost(const QStringList &handles);
+
+private:
+  FollowerSnapshot m_snapshot;
+  QStringList m_scanHandles;
+  bool m_scanning;
+  QDateTime m_scanStartedAt;
+  int m_refreshMinutes;
+};
+
+#endif // FOLLOWBACKRECONCILER_H
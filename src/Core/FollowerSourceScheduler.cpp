@@ -0,0 +1,213 @@
+#include "FollowerSourceScheduler.h"
+#include <QJsonObject>
+#include <limits>
+
+FollowerSourceScheduler::FollowerSourceScheduler(QObject *parent)
+    : QObject(parent) {}
+
+void FollowerSourceScheduler::loadState(const QJsonArray &records) {
+  for (const auto &v : records) {
+    QJsonObject obj = v.toObject();
+    QString handle = obj["handle"].toString();
+    if (handle.isEmpty()) {
+      continue;
+    }
+    FollowerSource &src = record(handle);
+    src.lastVisit =
+        QDateTime::fromString(obj["lastVisit"].toString(), Qt::ISODate);
+    src.visits = obj["visits"].toInt();
+    src.newAccounts = obj["newAccounts"].toInt();
+    src.recentYield = obj["recentYield"].toDouble();
+    src.zeroStreak = obj["zeroStreak"].toInt();
+    src.cooldownUntil =
+        QDateTime::fromString(obj["cooldownUntil"].toString(), Qt::ISODate);
+  }
+}
+
+QJsonArray FollowerSourceScheduler::saveState() const {
+  // 只保存仍在轮换环中的来源，已取关的用户随之清理
+  QJsonArray arr;
+  for (const auto &key : m_ring) {
+    const FollowerSource &src = m_sources[key];
+    if (src.visits == 0) {
+      continue;
+    }
+    QJsonObject obj;
+    obj["handle"] = src.handle;
+    obj["lastVisit"] = src.lastVisit.toString(Qt::ISODate);
+    obj["visits"] = src.visits;
+    obj["newAccounts"] = src.newAccounts;
+    obj["recentYield"] = src.recentYield;
+    obj["zeroStreak"] = src.zeroStreak;
+    if (src.cooldownUntil.isValid()) {
+      obj["cooldownUntil"] = src.cooldownUntil.toString(Qt::ISODate);
+    }
+    arr.append(obj);
+  }
+  return arr;
+}
+
+void FollowerSourceScheduler::setSources(const QStringList &handles) {
+  // 全量设置按顺序直接追加，不逐个插到游标前（启动时可能有上千个已关注用户）
+  m_ring.clear();
+  m_ringKeys.clear();
+  m_cursor = 0;
+  m_ring.reserve(handles.size());
+  for (const auto &handle : handles) {
+    if (handle.isEmpty()) {
+      continue;
+    }
+    QString key = handle.toLower();
+    if (m_ringKeys.contains(key)) {
+      continue;
+    }
+    record(handle);
+    m_ringKeys.insert(key);
+    m_ring.append(key);
+  }
+}
+
+void FollowerSourceScheduler::addSource(const QString &handle) {
+  if (handle.isEmpty()) {
+    return;
+  }
+  QString key = handle.toLower();
+  if (m_ringKeys.contains(key)) {
+    return;
+  }
+  record(handle);
+  m_ringKeys.insert(key);
+  // 插到游标前面，新来源在本轮最后才会被查看到，不打乱当前轮换
+  m_ring.insert(m_cursor, key);
+  m_cursor = (m_cursor + 1) % m_ring.size();
+}
+
+void FollowerSourceScheduler::removeSource(const QString &handle) {
+  QString key = handle.toLower();
+  if (!m_ringKeys.remove(key)) {
+    return;
+  }
+  int index = m_ring.indexOf(key);
+  m_ring.removeAt(index);
+  if (index < m_cursor) {
+    m_cursor--;
+  }
+  if (m_cursor >= m_ring.size()) {
+    m_cursor = 0;
+  }
+  if (m_current == key) {
+    m_current.clear();
+    m_currentNewAccounts = 0;
+  }
+}
+
+QString FollowerSourceScheduler::beginNextVisit(const QDateTime &now) {
+  if (m_ring.isEmpty()) {
+    return QString();
+  }
+
+  // 先看游标后的一个窗口；窗口内全部冷却时继续向后找，最多一整圈
+  int n = m_ring.size();
+  int best = -1;
+  double bestScore = -1.0;
+  for (int step = 0; step < n; ++step) {
+    if (step >= SCAN_WINDOW && best >= 0) {
+      break;
+    }
+    int index = (m_cursor + step) % n;
+    const FollowerSource &src = m_sources[m_ring[index]];
+    if (src.cooldownUntil.isValid() && src.cooldownUntil > now) {
+      continue;
+    }
+    double s = score(src, now);
+    if (s > bestScore) {
+      best = index;
+      bestScore = s;
+    }
+  }
+
+  if (best < 0) {
+    return QString();
+  }
+
+  m_cursor = (best + 1) % n;
+  m_current = m_ring[best];
+  m_currentNewAccounts = 0;
+
+  FollowerSource &src = m_sources[m_current];
+  src.lastVisit = now;
+  src.visits++;
+  src.cooldownUntil = QDateTime();
+  return src.handle;
+}
+
+void FollowerSourceScheduler::recordNewAccounts(int count) {
+  if (m_current.isEmpty() || count <= 0) {
+    return;
+  }
+  m_currentNewAccounts += count;
+  m_sources[m_current].newAccounts += count;
+}
+
+void FollowerSourceScheduler::finishVisit(const QDateTime &now) {
+  if (m_current.isEmpty()) {
+    return;
+  }
+
+  FollowerSource &src = m_sources[m_current];
+  src.recentYield = src.recentYield * YIELD_DECAY +
+                    m_currentNewAccounts * (1.0 - YIELD_DECAY);
+  if (m_currentNewAccounts > 0) {
+    src.zeroStreak = 0;
+  } else {
+    src.zeroStreak++;
+    if (src.zeroStreak >= EXHAUSTED_STREAK) {
+      // 冷却时间随连续零产出次数翻倍：24h、48h、96h...最长7天
+      int shift = qMin(src.zeroStreak - EXHAUSTED_STREAK, 8);
+      int hours = qMin(BASE_COOLDOWN_HOURS << shift, MAX_COOLDOWN_HOURS);
+      src.cooldownUntil = now.addSecs(qint64(hours) * 3600);
+    }
+  }
+
+  m_current.clear();
+  m_currentNewAccounts = 0;
+}
+
+int FollowerSourceScheduler::coolingCount(const QDateTime &now) const {
+  int count = 0;
+  for (const auto &key : m_ring) {
+    const FollowerSource &src = m_sources[key];
+    if (src.cooldownUntil.isValid() && src.cooldownUntil > now) {
+      count++;
+    }
+  }
+  return count;
+}
+
+const FollowerSource *
+FollowerSourceScheduler::source(const QString &handle) const {
+  auto it = m_sources.constFind(handle.toLower());
+  return it == m_sources.constEnd() ? nullptr : &it.value();
+}
+
+double FollowerSourceScheduler::score(const FollowerSource &source,
+                                      const QDateTime &now) const {
+  // 从未访问过的来源优先探索
+  if (source.visits == 0 || !source.lastVisit.isValid()) {
+    return std::numeric_limits<double>::max();
+  }
+  double hours = source.lastVisit.secsTo(now) / 3600.0;
+  double freshness = qBound(0.0, hours / REVISIT_HOURS, 1.0);
+  return (source.recentYield + YIELD_PRIOR) * freshness;
+}
+
+FollowerSource &FollowerSourceScheduler::record(const QString &handle) {
+  QString key = handle.toLower();
+  auto it = m_sources.find(key);
+  if (it == m_sources.end()) {
+    FollowerSource src;
+    src.handle = handle;
+    it = m_sources.insert(key, src);
+  }
+  return it.value();
+}
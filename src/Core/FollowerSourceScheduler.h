@@ -0,0 +1,80 @@
+#ifndef FOLLOWERSOURCESCHEDULER_H
+#define FOLLOWERSOURCESCHEDULER_H
+
+#include <QDateTime>
+#include <QHash>
+#include <QJsonArray>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+// 粉丝采集来源记录（一个互关用户的蓝V粉丝页）
+struct FollowerSource {
+  QString handle;
+  QDateTime lastVisit;         // 最近一次访问时间
+  int visits = 0;              // 累计访问次数
+  int newAccounts = 0;         // 累计采集到的新账号数
+  double recentYield = 0.0;    // 每次访问新账号数的指数衰减均值
+  int zeroStreak = 0;          // 连续零产出的访问次数
+  QDateTime cooldownUntil;     // 枯竭冷却截止时间（无效表示未冷却）
+};
+
+// 粉丝采集来源调度器
+// 维护互关用户组成的轮换环（随关注/取关增量更新，不再每次复制整个列表），
+// 每次从游标开始查看一个窗口内的来源，按得分挑选：
+//   得分 = (近期产出 + 先验) × 新鲜度，新鲜度 = min(1, 距上次访问小时数 / 回访间隔)
+//   从未访问过的来源优先；连续零产出的来源进入冷却，冷却时间随次数翻倍
+// 来源记录持久化到 followers_sources.json
+class FollowerSourceScheduler : public QObject {
+  Q_OBJECT
+
+public:
+  explicit FollowerSourceScheduler(QObject *parent = nullptr);
+
+  // 持久化
+  void loadState(const QJsonArray &records);
+  QJsonArray saveState() const;
+
+  // 轮换环维护
+  void setSources(const QStringList &handles); // 启动时全量设置
+  void addSource(const QString &handle);
+  void removeSource(const QString &handle);
+  bool isEmpty() const { return m_ring.isEmpty(); }
+  int size() const { return m_ring.size(); }
+
+  // 选择下一个要访问的来源，并作为当前访问开始计数
+  // 所有来源都在冷却中时返回空字符串
+  QString beginNextVisit(const QDateTime &now);
+
+  // 当前访问采集到的新账号
+  void recordNewAccounts(int count);
+
+  // 结束当前访问，更新衰减产出和枯竭状态（切换来源或暂停时调用）
+  void finishVisit(const QDateTime &now);
+
+  QString currentSource() const { return m_current; }
+  int coolingCount(const QDateTime &now) const;
+  const FollowerSource *source(const QString &handle) const;
+
+  static constexpr int SCAN_WINDOW = 32;         // 每次最多查看的候选数
+  static constexpr double YIELD_DECAY = 0.6;     // 旧产出保留比例
+  static constexpr double YIELD_PRIOR = 0.5;     // 产出先验（避免零产出来源得分为0）
+  static constexpr double REVISIT_HOURS = 6.0;   // 回访间隔
+  static constexpr int EXHAUSTED_STREAK = 3;     // 连续零产出多少次进入冷却
+  static constexpr int BASE_COOLDOWN_HOURS = 24; // 首次冷却时长
+  static constexpr int MAX_COOLDOWN_HOURS = 24 * 7;
+
+private:
+  double score(const FollowerSource &source, const QDateTime &now) const;
+  FollowerSource &record(const QString &handle);
+
+  QHash<QString, FollowerSource> m_sources; // 小写handle -> 来源记录
+  QStringList m_ring;                       // 轮换环（小写handle）
+  QSet<QString> m_ringKeys;                 // 环中的handle，O(1) 判断是否已在环中
+  int m_cursor = 0;                         // 下一次开始查看的位置
+  QString m_current;                        // 当前访问的来源
+  int m_currentNewAccounts = 0;             // 当前访问已采集的新账号数
+};
+
+#endif // FOLLOWERSOURCESCHEDULER_H
@@ -0,0 +1,129 @@
+#include "KeywordMatcher.h"
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QQueue>
+#include <algorithm>
+
+void KeywordMatcher::build(const QList<Keyword> &keywords) {
+  m_keywords.clear();
+  m_next = {QHash<QChar, int>()};
+  m_fail = {0};
+  m_out = {QVector<int>()};
+
+  // 1. trie
+  for (const auto &kw : keywords) {
+    QString lower = kw.text.toLower();
+    if (!kw.isEnabled || lower.isEmpty()) {
+      continue;
+    }
+
+    int state = 0;
+    for (QChar ch : lower) {
+      int next = m_next[state].value(ch, -1);
+      if (next < 0) {
+        next = m_next.size();
+        m_next[state].insert(ch, next);
+        m_next.append(QHash<QChar, int>());
+        m_fail.append(0);
+        m_out.append(QVector<int>());
+      }
+      state = next;
+    }
+    // 按小写去重（"AI" 和 "ai" 走到同一状态），命中记在先出现的关键词上
+    if (!m_out[state].isEmpty()) {
+      continue;
+    }
+    m_out[state].append(m_keywords.size());
+    m_keywords.append(kw.text);
+  }
+
+  // 2. 按层次 BFS 计算失败指针，并把失败状态的命中合并进来
+  QQueue<int> queue;
+  for (int child : m_next[0]) {
+    queue.enqueue(child);
+  }
+  while (!queue.isEmpty()) {
+    int state = queue.dequeue();
+    for (auto it = m_next[state].constBegin(); it != m_next[state].constEnd();
+         ++it) {
+      int child = it.value();
+      int fallback = m_fail[state];
+      while (fallback > 0 && !m_next[fallback].contains(it.key())) {
+        fallback = m_fail[fallback];
+      }
+      int target = m_next[fallback].value(it.key(), 0);
+      m_fail[child] = target == child ? 0 : target;
+      for (int k : m_out[m_fail[child]]) {
+        if (!m_out[child].contains(k)) {
+          m_out[child].append(k);
+        }
+      }
+      queue.enqueue(child);
+    }
+  }
+}
+
+int KeywordMatcher::step(int state, QChar ch) const {
+  while (state > 0 && !m_next[state].contains(ch)) {
+    state = m_fail[state];
+  }
+  return m_next[state].value(ch, 0);
+}
+
+QStringList KeywordMatcher::match(const QString &text) const {
+  QVector<bool> hit(m_keywords.size(), false);
+  int state = 0;
+  for (QChar ch : text.toLower()) {
+    state = step(state, ch);
+    for (int k : m_out[state]) {
+      hit[k] = true;
+    }
+  }
+
+  QStringList matched;
+  for (int i = 0; i < hit.size(); ++i) {
+    if (hit[i]) {
+      matched.append(m_keywords[i]);
+    }
+  }
+  return matched;
+}
+
+QByteArray KeywordMatcher::toJson() const {
+  QJsonArray next;
+  for (const auto &edges : m_next) {
+    QJsonObject obj;
+    for (auto it = edges.constBegin(); it != edges.constEnd(); ++it) {
+      obj.insert(QString(it.key()), it.value());
+    }
+    next.append(obj);
+  }
+
+  QJsonArray fail;
+  for (int state : m_fail) {
+    fail.append(state);
+  }
+
+  // 大部分状态没有命中，只输出非空的
+  QJsonObject out;
+  for (int state = 0; state < m_out.size(); ++state) {
+    if (m_out[state].isEmpty()) {
+      continue;
+    }
+    QVector<int> indexes = m_out[state];
+    std::sort(indexes.begin(), indexes.end());
+    QJsonArray arr;
+    for (int k : indexes) {
+      arr.append(k);
+    }
+    out.insert(QString::number(state), arr);
+  }
+
+  QJsonObject root;
+  root["keywords"] = QJsonArray::fromStringList(m_keywords);
+  root["next"] = next;
+  root["fail"] = fail;
+  root["out"] = out;
+  return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
@@ -0,0 +1,40 @@
+#ifndef KEYWORDMATCHER_H
+#define KEYWORDMATCHER_H
+
+#include "Data/Keyword.h"
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// 多关键词匹配自动机（Aho-Corasick）
+// 把启用的关键词（小写）编译成 trie + 失败指针，序列化后交给页面脚本：
+// 每条帖子只需把正文小写一次、逐字符走一遍自动机，即可得到命中的全部关键词，
+// 耗时与关键词数量无关（原来是每个关键词一次 includes）。
+// 字符按 UTF-16 码元处理，与 JS 字符串下标一致
+class KeywordMatcher {
+public:
+  void build(const QList<Keyword> &keywords);
+
+  // 命中的关键词文本（按关键词列表顺序，每个最多一次）
+  QStringList match(const QString &text) const;
+
+  // 页面脚本使用的紧凑 JSON：
+  // {"keywords":[原文],"next":[{"字":状态}],"fail":[状态],"out":{"状态":[关键词下标]}}
+  QByteArray toJson() const;
+
+  int keywordCount() const { return m_keywords.size(); }
+  int stateCount() const { return m_next.size(); }
+
+private:
+  int step(int state, QChar ch) const;
+
+  QStringList m_keywords;            // 原文（按小写去重后的启用关键词）
+  QVector<QHash<QChar, int>> m_next; // 状态 -> 字符 -> 下一状态（状态0为根）
+  QVector<int> m_fail;               // 失败指针
+  QVector<QVector<int>> m_out;       // 到达该状态时命中的关键词下标（已沿失败链合并）
+};
+
+#endif // KEYWORDMATCHER_H
@@ -0,0 +1,97 @@
+#include "KeywordScheduler.h"
+#include <QtMath>
+#include <limits>
+
+KeywordScheduler::KeywordScheduler(QObject *parent) : QObject(parent) {}
+
+double KeywordScheduler::value(const Keyword &keyword) {
+  if (keyword.recentLoads <= 0.0) {
+    return 0.0;
+  }
+  double yield = keyword.recentNewAccounts / keyword.recentLoads;
+  // 回关率用 Beta(1,1) 先验平滑，样本少时接近0.5，不会把新关键词判死
+  double followBack =
+      (keyword.followBackCount + 1.0) / (keyword.followedCount + 2.0);
+  return yield * followBack;
+}
+
+QList<double> KeywordScheduler::scores(const QList<Keyword> &keywords) const {
+  QList<double> result;
+  double totalLoads = 0.0;
+  double bestValue = 0.0;
+  for (const auto &kw : keywords) {
+    if (kw.isEnabled) {
+      totalLoads += kw.recentLoads;
+      bestValue = qMax(bestValue, value(kw));
+    }
+  }
+
+  for (const auto &kw : keywords) {
+    if (!kw.isEnabled) {
+      result.append(-1.0);
+      continue;
+    }
+    // 从未（或很久没有）加载过的关键词优先探索
+    if (kw.recentLoads < 1e-6) {
+      result.append(std::numeric_limits<double>::infinity());
+      continue;
+    }
+    double exploit = bestValue > 0.0 ? value(kw) / bestValue : 0.0;
+    double explore =
+        EXPLORATION * qSqrt(qLn(qMax(totalLoads, 1.0)) / kw.recentLoads);
+    result.append(exploit + explore);
+  }
+  return result;
+}
+
+int KeywordScheduler::pickGroup(const QList<Keyword> &keywords,
+                                const QList<QueryGroup> &groups) const {
+  QList<double> s = scores(keywords);
+  int best = -1;
+  double bestScore = 0.0;
+  double bestLoads = 0.0;
+  for (int g = 0; g < groups.size(); ++g) {
+    double groupScore = -1.0;
+    double groupLoads = 0.0;
+    for (int index : groups[g].keywordIndexes) {
+      if (index < 0 || index >= s.size()) {
+        continue;
+      }
+      groupScore = qMax(groupScore, s[index]);
+      groupLoads += keywords[index].recentLoads;
+    }
+    if (groupScore < 0.0) {
+      continue;
+    }
+    // 同分时选近期加载少的组，保证轮换
+    if (best < 0 || groupScore > bestScore ||
+        (groupScore == bestScore && groupLoads < bestLoads)) {
+      best = g;
+      bestScore = groupScore;
+      bestLoads = groupLoads;
+    }
+  }
+  return best;
+}
+
+void KeywordScheduler::recordPageLoad(QList<Keyword> &keywords,
+                                      const QList<int> &indexes) {
+  for (auto &kw : keywords) {
+    kw.recentLoads *= DISCOUNT;
+    kw.recentNewAccounts *= DISCOUNT;
+  }
+  for (int index : indexes) {
+    if (index < 0 || index >= keywords.size()) {
+      continue;
+    }
+    keywords[index].recentLoads += 1.0;
+    keywords[index].pageLoads++;
+  }
+}
+
+void KeywordScheduler::recordResults(Keyword &keyword, int newAccounts,
+                                     int duplicates) {
+  keyword.newAccounts += newAccounts;
+  keyword.duplicateHits += duplicates;
+  keyword.recentNewAccounts += newAccounts;
+}
@@ -0,0 +1,42 @@
+#ifndef KEYWORDSCHEDULER_H
+#define KEYWORDSCHEDULER_H
+
+#include "Data/Keyword.h"
+#include "QueryPlanner.h"
+#include <QList>
+#include <QObject>
+
+// 关键词调度器：按近期产出选择下一个搜索关键词
+// 使用折扣UCB（Discounted UCB）：
+//   - 每次搜索页加载，所有关键词的近期统计乘以折扣系数，被选中的加1次加载
+//   - 价值 = 近期每次加载的新账号数 × 回关率（Beta(1,1)先验平滑），按最大值归一化
+//   - 得分 = 价值 + 探索项 sqrt(ln(总加载) / 该关键词加载)
+// 枯竭的关键词价值下降，很久没被选中的关键词探索项上升，会被重新尝试
+// 关键词按 OR 查询组加载时，组得分取组内关键词得分的最大值
+class KeywordScheduler : public QObject {
+  Q_OBJECT
+
+public:
+  explicit KeywordScheduler(QObject *parent = nullptr);
+
+  // 选择下一个查询组，返回 groups 中的下标（没有可用的组时返回-1）
+  int pickGroup(const QList<Keyword> &keywords,
+                const QList<QueryGroup> &groups) const;
+
+  // 记录一次搜索页加载（组内每个关键词各计一次曝光）
+  void recordPageLoad(QList<Keyword> &keywords, const QList<int> &indexes);
+
+  // 记录该关键词页面带来的新账号和重复账号
+  void recordResults(Keyword &keyword, int newAccounts, int duplicates);
+
+  // 计算所有启用关键词的得分（与 pickNext 使用同一公式，便于展示）
+  QList<double> scores(const QList<Keyword> &keywords) const;
+
+private:
+  static double value(const Keyword &keyword);
+
+  static constexpr double DISCOUNT = 0.95;   // 每次加载的折扣系数
+  static constexpr double EXPLORATION = 0.6; // 探索项系数
+};
+
+#endif // KEYWORDSCHEDULER_H
@@ -2,9 +2,13 @@
 #define POSTMONITOR_H
 
 #include "Data/Keyword.h"
+#include "KeywordMatcher.h"
+#include <QByteArray>
 #include <QList>
 #include <QObject>
 #include <QString>
+#include <QStringList>
+#include <string>
 
 class PostMonitor : public QObject {
   Q_OBJECT
@@ -12,17 +16,36 @@ class PostMonitor : public QObject {
 public:
   explicit PostMonitor(QObject *parent = nullptr);
 
-  // 获取监控脚本
-  QString getMonitorScript(const QList<Keyword> &keywords);
+  // 获取监控脚本（共用模块 + src/Scripts/monitor.js），不含关键词，只注册一次
+  const std::string &getMonitorScript();
+  // 监控脚本的前置数据：关键词自动机（window.xfollowingMatcher=...），关键词变化时只更新这一段
+  std::string getMonitorPrelude(const QList<Keyword> &keywords);
+
+  // 关键词热更新：只调用页面中已有脚本的 xfollowing.setMatcher({...})
+  std::string getKeywordsUpdateScript(const QList<Keyword> &keywords);
 
   // 获取粉丝页面监控脚本
-  QString getFollowersMonitorScript();
+  const std::string &getFollowersMonitorScript();
 
   // 获取回关探测脚本（用于verified_followers页面）
-  QString getFollowBackDetectScript();
+  const std::string &getFollowBackDetectScript();
+
+  // 在 C++ 端匹配关键词（接口抓取到的帖子），与页面脚本用同一个自动机
+  QStringList matchKeywords(const QList<Keyword> &keywords,
+                            const QString &text);
 
 private:
-  QString buildKeywordsArray(const QList<Keyword> &keywords);
+  // 编译启用的关键词；关键词没变时复用上次的结果
+  const QByteArray &compiledMatcher(const QList<Keyword> &keywords);
+
+  KeywordMatcher m_matcher;
+  QStringList m_matcherKeywords; // 上次编译时的启用关键词
+  QByteArray m_matcherJson;
+
+  // 资源脚本前面拼上共用模块（id_cache.js、batch.js），首次使用时拼接一次
+  std::string m_monitorScript;
+  std::string m_followersScript;
+  std::string m_followBackScript;
 };
 
 #endif // POSTMONITOR_H
@@ -0,0 +1,68 @@
+#include "QueryPlanner.h"
+#include <QUrl>
+
+namespace {
+const QString kFilterSuffix = " filter:blue_verified";
+}
+
+QueryPlanner::QueryPlanner(QObject *parent) : QObject(parent) {}
+
+QString QueryPlanner::quoteTerm(const QString &keyword) {
+  // 含空格的短语需要加引号，否则 OR 只作用于最后一个词
+  QString term = keyword;
+  term.remove('"');
+  if (term.contains(' ')) {
+    return '"' + term + '"';
+  }
+  return term;
+}
+
+QString QueryPlanner::buildQuery(const QStringList &keywords) {
+  if (keywords.size() == 1) {
+    return quoteTerm(keywords.first()) + kFilterSuffix;
+  }
+  QStringList terms;
+  for (const auto &kw : keywords) {
+    terms.append(quoteTerm(kw));
+  }
+  return '(' + terms.join(" OR ") + ')' + kFilterSuffix;
+}
+
+QString QueryPlanner::buildSearchUrl(const QString &query) {
+  return QString("https://x.com/search?q=%1&f=live")
+      .arg(QString::fromUtf8(QUrl::toPercentEncoding(query)));
+}
+
+QList<QueryGroup> QueryPlanner::plan(const QList<Keyword> &keywords,
+                                     int maxQueryLength) const {
+  QList<QueryGroup> groups;
+  QueryGroup current;
+
+  for (int i = 0; i < keywords.size(); ++i) {
+    const Keyword &kw = keywords[i];
+    if (!kw.isEnabled || kw.text.trimmed().isEmpty()) {
+      continue;
+    }
+
+    QStringList candidate = current.keywords;
+    candidate.append(kw.text);
+    QString query = buildQuery(candidate);
+
+    // 当前组放不下则另起一组（空组时即使超长也必须放入）
+    if (!current.keywords.isEmpty() && query.size() > maxQueryLength) {
+      groups.append(current);
+      current = QueryGroup();
+      candidate = QStringList{kw.text};
+      query = buildQuery(candidate);
+    }
+
+    current.keywordIndexes.append(i);
+    current.keywords = candidate;
+    current.query = query;
+  }
+
+  if (!current.keywords.isEmpty()) {
+    groups.append(current);
+  }
+  return groups;
+}
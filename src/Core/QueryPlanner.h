@@ -0,0 +1,39 @@
+#ifndef QUERYPLANNER_H
+#define QUERYPLANNER_H
+
+#include "Data/Keyword.h"
+#include <QList>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+
+// 搜索查询组：多个关键词用 OR 合并为一次搜索页加载
+struct QueryGroup {
+  QList<int> keywordIndexes; // 在关键词列表中的下标
+  QStringList keywords;      // 关键词文本
+  QString query;             // 完整查询，如 (互关 OR 回关) filter:blue_verified
+};
+
+// 搜索查询规划器
+// 按关键词列表顺序把启用的关键词贪心装入 OR 查询，每个查询不超过最大长度；
+// 单个关键词本身超长时单独成组
+class QueryPlanner : public QObject {
+  Q_OBJECT
+
+public:
+  explicit QueryPlanner(QObject *parent = nullptr);
+
+  static const int DEFAULT_MAX_QUERY_LENGTH = 200;
+
+  QList<QueryGroup> plan(const QList<Keyword> &keywords,
+                         int maxQueryLength) const;
+
+  // 构建查询和Latest搜索URL（f=live表示Latest/最新）
+  static QString buildQuery(const QStringList &keywords);
+  static QString buildSearchUrl(const QString &query);
+
+private:
+  static QString quoteTerm(const QString &keyword);
+};
+
+#endif // QUERYPLANNER_H
@@ -0,0 +1,108 @@
+#include "RendererWatchdog.h"
+#include "Utils/Logger.h"
+#include "Utils/ProcessStats.h"
+
+RendererWatchdog::RendererWatchdog(QObject *parent)
+    : QObject(parent), m_sampleTimer(new QTimer(this)), m_budgetMB(0),
+      m_totalRecycles(0) {
+  m_sampleTimer->setInterval(SAMPLE_INTERVAL_MS);
+  connect(m_sampleTimer, &QTimer::timeout, this,
+          &RendererWatchdog::onSampleTick);
+}
+
+void RendererWatchdog::setBudgetMB(int budgetMB) {
+  m_budgetMB = qMax(0, budgetMB);
+}
+
+void RendererWatchdog::watch(const QString &label,
+                             std::function<qint64()> rendererPid,
+                             std::function<bool()> isSafePoint,
+                             std::function<bool()> recycle) {
+  Target target;
+  target.label = label;
+  target.rendererPid = std::move(rendererPid);
+  target.isSafePoint = std::move(isSafePoint);
+  target.recycle = std::move(recycle);
+  m_targets.append(target);
+}
+
+void RendererWatchdog::start() {
+  if (m_budgetMB <= 0) {
+    xfInfo(lcCef) << "Renderer memory watchdog disabled";
+    return;
+  }
+  xfInfo(lcCef) << "Renderer memory watchdog started"
+                << Logger::kv("budgetMB", m_budgetMB)
+                << Logger::kv("browsers", m_targets.size());
+  m_sampleTimer->start();
+}
+
+void RendererWatchdog::stop() { m_sampleTimer->stop(); }
+
+void RendererWatchdog::onSampleTick() {
+  const qint64 budgetBytes = qint64(m_budgetMB) * 1024 * 1024;
+
+  for (Target &target : m_targets) {
+    ProcessStats::Sample usage = ProcessStats::sample(target.rendererPid());
+
+    // 回收后的测量
+    if (target.awaitingAfterSample &&
+        target.sinceRecycle.elapsed() >= AFTER_SAMPLE_DELAY_MS) {
+      target.awaitingAfterSample = false;
+      if (usage.valid) {
+        xfInfo(lcCef).noquote()
+            << QString("[RECYCLE] %1 done before=%2MB after=%3MB (#%4)")
+                   .arg(target.label)
+                   .arg(target.recycleBeforeBytes / (1024 * 1024))
+                   .arg(usage.privateBytes / (1024 * 1024))
+                   .arg(target.recycles);
+      }
+    }
+
+    if (!usage.valid || usage.privateBytes <= budgetBytes) {
+      target.overBudgetSamples = 0;
+      target.deferredSamples = 0;
+      continue;
+    }
+
+    target.overBudgetSamples++;
+    if (target.overBudgetSamples < OVER_BUDGET_SAMPLES) {
+      continue;
+    }
+    if (target.awaitingAfterSample ||
+        (target.sinceRecycle.isValid() &&
+         target.sinceRecycle.elapsed() <
+             qint64(MIN_RECYCLE_INTERVAL_MINS) * 60 * 1000)) {
+      continue;
+    }
+    if (target.isSafePoint && !target.isSafePoint()) {
+      target.deferredSamples++;
+      xfDebug(lcCef) << "[RECYCLE]" << target.label
+                     << "over budget, waiting for safe point"
+                     << Logger::kv("privateMB",
+                                   usage.privateBytes / (1024 * 1024))
+                     << Logger::kv("deferred", target.deferredSamples);
+      continue;
+    }
+
+    if (!target.recycle()) {
+      xfDebug(lcCef) << "[RECYCLE]" << target.label
+                     << "over budget, page cannot be recycled yet";
+      continue;
+    }
+    target.recycleBeforeBytes = usage.privateBytes;
+    target.overBudgetSamples = 0;
+    target.deferredSamples = 0;
+    target.awaitingAfterSample = true;
+    target.sinceRecycle.start();
+    target.recycles++;
+    m_totalRecycles++;
+    xfInfo(lcCef).noquote()
+        << QString("[RECYCLE] %1 privateMB=%2 budgetMB=%3 workingSetMB=%4, "
+                   "recycling renderer")
+               .arg(target.label)
+               .arg(usage.privateBytes / (1024 * 1024))
+               .arg(m_budgetMB)
+               .arg(usage.workingSetBytes / (1024 * 1024));
+  }
+}
@@ -0,0 +1,65 @@
+#ifndef RENDERERWATCHDOG_H
+#define RENDERERWATCHDOG_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <QVector>
+#include <functional>
+
+// 渲染进程内存看门狗
+// 时间线页面长期运行（无限滚动、MutationObserver、已处理ID集合），渲染进程内存会持续上涨。
+// 每分钟采样各浏览器渲染进程的私有内存，连续 OVER_BUDGET_SAMPLES 次超过预算时，
+// 在安全点（没有正在进行的操作）调用 recycle 由界面重建浏览器，重建成功才计数；
+// 回收后 AFTER_SAMPLE_DELAY_MS 再采样一次，记录回收前后的内存
+class RendererWatchdog : public QObject {
+  Q_OBJECT
+
+public:
+  explicit RendererWatchdog(QObject *parent = nullptr);
+
+  // 预算（MB），0 表示关闭
+  void setBudgetMB(int budgetMB);
+  int budgetMB() const { return m_budgetMB; }
+
+  // rendererPid: 当前渲染进程 PID（0 表示没有页面）
+  // isSafePoint: 为 false 时推迟回收（如正在关注/检查回关）
+  // recycle: 重建浏览器，返回 false 表示没有重建（如还没有可恢复的 URL）
+  void watch(const QString &label, std::function<qint64()> rendererPid,
+             std::function<bool()> isSafePoint, std::function<bool()> recycle);
+
+  void start();
+  void stop();
+
+  int recycleCount() const { return m_totalRecycles; }
+
+  static const int SAMPLE_INTERVAL_MS = 60 * 1000;
+  static const int AFTER_SAMPLE_DELAY_MS = 2 * 60 * 1000; // 回收后等页面稳定再测
+  static const int OVER_BUDGET_SAMPLES = 2;      // 连续超标次数（忽略瞬时峰值）
+  static const int MIN_RECYCLE_INTERVAL_MINS = 30; // 同一浏览器两次回收的最短间隔
+
+private slots:
+  void onSampleTick();
+
+private:
+  struct Target {
+    QString label;
+    std::function<qint64()> rendererPid;
+    std::function<bool()> isSafePoint;
+    std::function<bool()> recycle;
+    int overBudgetSamples = 0;
+    int deferredSamples = 0;   // 超标但不在安全点而推迟的次数
+    qint64 recycleBeforeBytes = 0;
+    bool awaitingAfterSample = false;
+    QElapsedTimer sinceRecycle;
+    int recycles = 0;
+  };
+
+  QTimer *m_sampleTimer;
+  QVector<Target> m_targets;
+  int m_budgetMB;
+  int m_totalRecycles;
+};
+
+#endif // RENDERERWATCHDOG_H
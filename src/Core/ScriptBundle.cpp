@@ -0,0 +1,39 @@
+#include "ScriptBundle.h"
+#include "Utils/Logger.h"
+#include <QFile>
+#include <map>
+
+namespace ScriptBundle {
+
+const std::string &get(const QString &name) {
+  // std::map 的元素地址在插入后保持不变，可以直接返回引用
+  static std::map<QString, std::string> cache;
+
+  auto it = cache.find(name);
+  if (it != cache.end()) {
+    return it->second;
+  }
+
+  std::string code;
+  QFile file(":/scripts/" + name + ".js");
+  if (file.open(QIODevice::ReadOnly)) {
+    QByteArray bytes = file.readAll();
+    code.assign(bytes.constData(), static_cast<size_t>(bytes.size()));
+    xfDebug(lcMonitor) << "Loaded script" << name
+                       << Logger::kv("bytes", bytes.size());
+  } else {
+    xfWarning(lcMonitor) << "Script resource missing:" << file.fileName();
+  }
+  return cache.emplace(name, std::move(code)).first->second;
+}
+
+std::string join(std::initializer_list<const char *> names) {
+  std::string script;
+  for (const char *name : names) {
+    script += get(name);
+    script += "\n";
+  }
+  return script;
+}
+
+} // namespace ScriptBundle
@@ -0,0 +1,19 @@
+#ifndef SCRIPTBUNDLE_H
+#define SCRIPTBUNDLE_H
+
+#include <QString>
+#include <initializer_list>
+#include <string>
+
+// 注入脚本资源
+// 源码在 src/Scripts/*.js，构建时压缩后嵌入 Qt 资源 :/scripts/<name>.js；
+// 首次使用时读取一次并缓存为 UTF-8 std::string，之后每次注入直接复用，
+// 不再重复拼接/替换大段脚本字符串（只在主线程使用）
+namespace ScriptBundle {
+// name 不带扩展名，如 "monitor"；资源不存在时返回空字符串
+const std::string &get(const QString &name);
+// 依次拼接资源脚本：共用模块（ID缓存、批量上报、就绪等待等）在前，页面脚本在后
+std::string join(std::initializer_list<const char *> names);
+} // namespace ScriptBundle
+
+#endif // SCRIPTBUNDLE_H
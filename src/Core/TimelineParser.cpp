@@ -0,0 +1,191 @@
+#include "TimelineParser.h"
+#include <QJsonDocument>
+#include <QLocale>
+#include <QStringList>
+#include <QTimeZone>
+
+namespace {
+
+const int kMaxDepth = 64;
+
+// 只读访问（非 const 的 operator[] 会插入缺失的键）
+QJsonObject child(const QJsonObject &obj, const char *key) {
+  return obj.value(QLatin1String(key)).toObject();
+}
+
+// full_text 里的 HTML 实体（页面显示时已解码）
+QString decodeEntities(QString text) {
+  text.replace("&lt;", "<");
+  text.replace("&gt;", ">");
+  text.replace("&amp;", "&");
+  return text;
+}
+
+// display_text_range 按 Unicode 码点计数：去掉回复开头的 @用户 和结尾的媒体链接，
+// 与页面 tweetText 显示的正文一致
+QString displayText(const QString &fullText, const QJsonArray &range) {
+  if (range.size() != 2) {
+    return fullText;
+  }
+  QList<uint> codePoints = fullText.toUcs4();
+  int start = qBound(0, range[0].toInt(), int(codePoints.size()));
+  int end = qBound(start, range[1].toInt(), int(codePoints.size()));
+  const char32_t *data =
+      reinterpret_cast<const char32_t *>(codePoints.constData());
+  return QString::fromUcs4(data + start, end - start);
+}
+
+} // namespace
+
+TimelineParser::Result TimelineParser::parse(const QByteArray &json) {
+  Result result;
+  QJsonParseError error;
+  QJsonDocument doc = QJsonDocument::fromJson(json, &error);
+  if (error.error != QJsonParseError::NoError || !doc.isObject()) {
+    return result;
+  }
+  result.ok = true;
+  walk(doc.object(), result, 0);
+  return result;
+}
+
+QDateTime TimelineParser::parseCreatedAt(const QString &text) {
+  QDateTime time =
+      QLocale::c().toDateTime(text, "ddd MMM dd HH:mm:ss +0000 yyyy");
+  if (time.isValid()) {
+    time.setTimeZone(QTimeZone::utc());
+  }
+  return time;
+}
+
+void TimelineParser::walk(const QJsonValue &value, Result &result, int depth) {
+  if (depth > kMaxDepth) {
+    return;
+  }
+  if (value.isArray()) {
+    for (const auto &item : value.toArray()) {
+      walk(item, result, depth + 1);
+    }
+    return;
+  }
+  if (!value.isObject()) {
+    return;
+  }
+
+  const QJsonObject obj = value.toObject();
+  QString itemType = obj["itemType"].toString();
+  if (itemType == "TimelineTweet") {
+    QJsonObject post = parseTweet(child(child(obj, "tweet_results"), "result"));
+    if (!post.isEmpty()) {
+      result.posts.append(post);
+    }
+    return;
+  }
+  if (itemType == "TimelineUser") {
+    QJsonObject user = parseUser(child(child(obj, "user_results"), "result"));
+    if (!user.isEmpty()) {
+      result.users.append(user);
+    }
+    return;
+  }
+
+  for (auto it = obj.constBegin(); it != obj.constEnd(); ++it) {
+    if (it.value().isObject() || it.value().isArray()) {
+      walk(it.value(), result, depth + 1);
+    }
+  }
+}
+
+QJsonObject TimelineParser::parseTweet(QJsonObject tweet) {
+  // 受限帖子外面多包一层
+  if (tweet.value("__typename").toString() == "TweetWithVisibilityResults") {
+    tweet = child(tweet, "tweet");
+  }
+  QString postId = tweet.value("rest_id").toString();
+  if (postId.isEmpty()) {
+    return QJsonObject(); // TweetTombstone 等
+  }
+
+  const QJsonObject author =
+      parseUser(child(child(child(tweet, "core"), "user_results"), "result"));
+  QString authorHandle = author["handle"].toString();
+  if (authorHandle.isEmpty()) {
+    return QJsonObject();
+  }
+
+  const QJsonObject legacy = child(tweet, "legacy");
+  const QJsonObject entities = child(legacy, "entities");
+
+  // 长帖的全文在 note_tweet 里，legacy.full_text 只有前 280 字
+  QString content =
+      child(child(child(tweet, "note_tweet"), "note_tweet_results"), "result")
+          .value("text")
+          .toString();
+  if (content.isEmpty()) {
+    content = displayText(legacy["full_text"].toString(),
+                          legacy["display_text_range"].toArray());
+  }
+  // t.co 短链换成页面上显示的地址
+  for (const auto &v : entities["urls"].toArray()) {
+    const QJsonObject url = v.toObject();
+    content.replace(url["url"].toString(), url["display_url"].toString());
+  }
+  content = decodeEntities(content).trimmed();
+
+  QStringList mentionedUsers;
+  for (const auto &v : entities["user_mentions"].toArray()) {
+    QString handle = v.toObject().value("screen_name").toString();
+    if (!handle.isEmpty() &&
+        handle.compare(authorHandle, Qt::CaseInsensitive) != 0 &&
+        !mentionedUsers.contains(handle)) {
+      mentionedUsers.append(handle);
+    }
+  }
+
+  QDateTime postTime = parseCreatedAt(legacy["created_at"].toString());
+
+  QJsonObject post;
+  post["postId"] = postId;
+  post["authorHandle"] = authorHandle;
+  post["authorName"] = author["name"].toString();
+  post["authorUrl"] = "https://x.com/" + authorHandle;
+  post["verified"] = author["verified"].toBool();
+  post["content"] = content;
+  post["postUrl"] =
+      QString("https://x.com/%1/status/%2").arg(authorHandle, postId);
+  post["postTime"] = postTime.isValid() ? postTime.toString(Qt::ISODate)
+                                        : QString();
+  post["mentionedUsers"] = QJsonArray::fromStringList(mentionedUsers);
+  return post;
+}
+
+QJsonObject TimelineParser::parseUser(const QJsonObject &user) {
+  const QJsonObject legacy = child(user, "legacy");
+  const QJsonObject core = child(user, "core");
+  const QJsonObject relationship = child(user, "relationship_perspectives");
+
+  // 新版接口把 screen_name/name 移到了 core，旧版在 legacy
+  QString handle = core["screen_name"].toString();
+  if (handle.isEmpty()) {
+    handle = legacy["screen_name"].toString();
+  }
+  if (handle.isEmpty()) {
+    return QJsonObject();
+  }
+  QString name = core["name"].toString();
+  if (name.isEmpty()) {
+    name = legacy["name"].toString(handle);
+  }
+
+  QJsonObject result;
+  result["handle"] = handle;
+  result["name"] = name;
+  result["verified"] = user["is_blue_verified"].toBool() ||
+                       legacy["verified"].toBool() ||
+                       child(user, "verification").value("verified").toBool();
+  result["followedBy"] = legacy["followed_by"].toBool() ||
+                         relationship["followed_by"].toBool();
+  result["following"] =
+      legacy["following"].toBool() || relationship["following"].toBool();
+  return result;
+}
@@ -0,0 +1,36 @@
+#ifndef TIMELINEPARSER_H
+#define TIMELINEPARSER_H
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QString>
+
+// X 网页端 GraphQL 时间线响应解析（SearchTimeline / Followers / BlueVerifiedFollowers）
+// 不依赖固定的 JSON 路径：递归查找 itemType 为 TimelineTweet / TimelineUser 的条目，
+// 接口外层结构调整时仍能取到帖子和用户。
+// 输出的字段与页面脚本从 DOM 提取的一致，抓不到的仍由 DOM 路径兜底
+class TimelineParser {
+public:
+  struct Result {
+    // {postId, authorHandle, authorName, authorUrl, verified, content, postUrl,
+    //  postTime, mentionedUsers}
+    QJsonArray posts;
+    // {handle, name, verified, followedBy, following}
+    QJsonArray users;
+    bool ok = false; // JSON 有效
+  };
+
+  static Result parse(const QByteArray &json);
+
+  // "Wed Oct 10 20:19:24 +0000 2018" -> UTC 时间
+  static QDateTime parseCreatedAt(const QString &text);
+
+private:
+  static void walk(const QJsonValue &value, Result &result, int depth);
+  static QJsonObject parseTweet(QJsonObject tweet);
+  static QJsonObject parseUser(const QJsonObject &user);
+};
+
+#endif // TIMELINEPARSER_H
@@ -1,10 +1,12 @@
 #include "DataStorage.h"
+#include "Utils/Logger.h"
 #include <QCoreApplication>
 #include <QDate>
 #include <QDebug>
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QHash>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QStandardPaths>
@@ -24,10 +26,10 @@ DataStorage::DataStorage(QObject *parent)
   m_dataPath = appDataDir + "/data";
   m_backupPath = appDataDir + "/backups";
 
-  qDebug() << "[INFO] Data path:" << m_dataPath;
-  qDebug() << "[INFO] Backup path:" << m_backupPath;
-  qDebug() << "[INFO] Profile path:" << m_profilePath;
-  qDebug() << "[INFO] Scanner profile path:" << m_scannerProfilePath;
+  xfInfo(lcStorage) << "Data path:" << m_dataPath;
+  xfInfo(lcStorage) << "Backup path:" << m_backupPath;
+  xfInfo(lcStorage) << "Profile path:" << m_profilePath;
+  xfInfo(lcStorage) << "Scanner profile path:" << m_scannerProfilePath;
 
   ensureDataDir();
 
@@ -49,7 +51,7 @@ DataStorage::DataStorage(QObject *parent)
 DataStorage::~DataStorage() {
   // 确保退出时保存未写入的数据
   if (m_postsDirty) {
-    qDebug() << "[INFO] Saving pending posts on destruction...";
+    xfInfo(lcStorage) << "Saving pending posts on destruction...";
     savePostsFromCache();
   }
 }
@@ -167,7 +169,7 @@ void DataStorage::loadPostsToCache() {
   }
 
   m_postsCacheLoaded = true;
-  qDebug() << "[INFO] Posts cache loaded:" << m_postsCache.size() << "posts";
+  xfInfo(lcStorage) << "Posts cache loaded:" << m_postsCache.size() << "posts";
 }
 
 QList<Post> DataStorage::loadPosts() {
@@ -219,6 +221,48 @@ void DataStorage::updatePost(const Post &post) {
   }
 }
 
+void DataStorage::addPosts(const QList<Post> &posts) {
+  loadPostsToCache();
+
+  bool added = false;
+  for (const auto &post : posts) {
+    if (m_postIdIndex.contains(post.postId)) {
+      continue;
+    }
+    m_postsCache.prepend(post); // 与 addPost 一致，新帖子放在最前面
+    m_postIdIndex.insert(post.postId);
+    added = true;
+  }
+
+  if (added) {
+    m_postsDirty = true;
+    scheduleSave();
+  }
+}
+
+void DataStorage::updatePosts(const QList<Post> &posts) {
+  loadPostsToCache();
+
+  QHash<QString, const Post *> byId;
+  for (const auto &post : posts) {
+    byId.insert(post.postId, &post);
+  }
+
+  int remaining = byId.size();
+  for (int i = 0; i < m_postsCache.size() && remaining > 0; ++i) {
+    auto it = byId.constFind(m_postsCache[i].postId);
+    if (it != byId.constEnd()) {
+      m_postsCache[i] = **it;
+      remaining--;
+    }
+  }
+
+  if (remaining < byId.size()) {
+    m_postsDirty = true;
+    scheduleSave();
+  }
+}
+
 bool DataStorage::postExists(const QString &postId) {
   loadPostsToCache();
   // O(1) 查询
@@ -226,8 +270,9 @@ bool DataStorage::postExists(const QString &postId) {
 }
 
 void DataStorage::scheduleSave() {
-  // 重置定时器，延迟5秒后保存
-  if (m_saveTimer) {
+  // 第一次修改后延迟5秒保存；期间的修改合并到这次保存，
+  // 不重置定时器（否则持续采集时会一直推迟保存）
+  if (m_saveTimer && !m_saveTimer->isActive()) {
     m_saveTimer->start(SAVE_DELAY_MS);
   }
 }
@@ -266,7 +311,7 @@ void DataStorage::savePostsFromCache() {
 
   QFile tmpFile(tmpPath);
   if (!tmpFile.open(QIODevice::WriteOnly)) {
-    qDebug() << "[ERROR] Failed to create temp file:" << tmpPath;
+    xfWarning(lcStorage) << "Failed to create temp file:" << tmpPath;
     return;
   }
   tmpFile.write(QJsonDocument(arr).toJson(QJsonDocument::Indented));
@@ -278,7 +323,7 @@ void DataStorage::savePostsFromCache() {
       QFile::remove(bakPath);
     }
     if (!QFile::rename(filePath, bakPath)) {
-      qDebug() << "[ERROR] Failed to backup posts.json";
+      xfWarning(lcStorage) << "Failed to backup posts.json";
       QFile::remove(tmpPath);
       return;
     }
@@ -286,7 +331,7 @@ void DataStorage::savePostsFromCache() {
 
   // 3. 原子替换：tmp -> json
   if (!QFile::rename(tmpPath, filePath)) {
-    qDebug() << "[ERROR] Failed to rename temp file to posts.json";
+    xfWarning(lcStorage) << "Failed to rename temp file to posts.json";
     // 尝试恢复备份
     if (QFile::exists(bakPath)) {
       QFile::rename(bakPath, filePath);
@@ -295,7 +340,7 @@ void DataStorage::savePostsFromCache() {
   }
 
   m_postsDirty = false;
-  qDebug() << "[INFO] Posts saved to disk:" << m_postsCache.size() << "posts";
+  xfInfo(lcStorage) << "Posts saved to disk:" << m_postsCache.size() << "posts";
   emit postsSaved();
 }
 
@@ -334,7 +379,7 @@ void DataStorage::migrateOldData() {
       continue;
     }
 
-    qDebug() << "[Migration] Checking old data path:" << oldPath;
+    xfInfo(lcStorage) << "[Migration] Checking old data path:" << oldPath;
 
     for (const QString &fileName : dataFiles) {
       QString oldFile = oldPath + "/" + fileName;
@@ -361,10 +406,11 @@ void DataStorage::migrateOldData() {
           QFile::remove(newFile);
         }
         if (QFile::copy(oldFile, newFile)) {
-          qDebug() << "[Migration] Migrated" << fileName << "from" << oldPath;
+          xfInfo(lcStorage) << "[Migration] Migrated" << fileName << "from"
+                            << oldPath;
         } else {
-          qDebug() << "[Migration] Failed to migrate" << fileName << "from"
-                   << oldPath;
+          xfWarning(lcStorage) << "[Migration] Failed to migrate" << fileName
+                               << "from" << oldPath;
         }
       }
     }
@@ -378,13 +424,14 @@ void DataStorage::createDailyBackup() {
   QDir dir;
   // 如果今天的备份目录已存在，跳过
   if (dir.exists(todayBackupDir)) {
-    qDebug() << "[Backup] Today's backup already exists:" << today;
+    xfInfo(lcStorage) << "[Backup] Today's backup already exists:" << today;
     return;
   }
 
   // 创建今天的备份目录
   if (!dir.mkpath(todayBackupDir)) {
-    qDebug() << "[Backup] Failed to create backup directory:" << todayBackupDir;
+    xfWarning(lcStorage) << "[Backup] Failed to create backup directory:"
+                         << todayBackupDir;
     return;
   }
 
@@ -404,8 +451,8 @@ void DataStorage::createDailyBackup() {
   }
 
   if (copiedCount > 0) {
-    qDebug() << "[Backup] Created daily backup:" << today << "(" << copiedCount
-             << "files)";
+    xfInfo(lcStorage) << "[Backup] Created daily backup:" << today << "("
+                      << copiedCount << "files)";
   }
 }
 
@@ -426,14 +473,14 @@ void DataStorage::cleanOldBackups(int keepDays) {
       QDir dirToRemove(fullPath);
       if (dirToRemove.removeRecursively()) {
         removedCount++;
-        qDebug() << "[Backup] Removed old backup:" << dirName;
+        xfInfo(lcStorage) << "[Backup] Removed old backup:" << dirName;
       }
     }
   }
 
   if (removedCount > 0) {
-    qDebug() << "[Backup] Cleaned" << removedCount << "old backups (older than"
-             << keepDays << "days)";
+    xfInfo(lcStorage) << "[Backup] Cleaned" << removedCount
+                      << "old backups (older than" << keepDays << "days)";
   }
 }
 
@@ -468,27 +515,143 @@ void DataStorage::saveUsedFollowBackHandles(const QSet<QString> &handles) {
   }
 }
 
-QJsonArray DataStorage::loadGeneratedTweets() {
-  QString filePath = m_dataPath + "/generated_tweets.json";
-  QFile file(filePath);
-  if (!file.open(QIODevice::ReadOnly)) {
-    return QJsonArray();
+QList<GeneratedTweet> DataStorage::loadGeneratedTweets() {
+  QList<GeneratedTweet> tweets;
+  QHash<int, int> indexById; // id -> tweets 下标
+
+  // 1. 加载快照（兼容旧格式：纯字符串 / 中文状态）
+  bool needsCompact = false;
+  QFile snapshotFile(m_dataPath + "/generated_tweets.json");
+  if (snapshotFile.open(QIODevice::ReadOnly)) {
+    QJsonDocument doc = QJsonDocument::fromJson(snapshotFile.readAll());
+    snapshotFile.close();
+    QJsonArray arr = doc.array();
+    for (int i = 0; i < arr.size(); ++i) {
+      if (!arr[i].isObject() || !arr[i].toObject().contains("id")) {
+        needsCompact = true; // 旧格式，需要重写为新快照
+      }
+      GeneratedTweet tweet = GeneratedTweet::fromJson(arr[i], i + 1);
+      indexById.insert(tweet.id, tweets.size());
+      tweets.append(tweet);
+    }
   }
-  QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+
+  // 2. 重放追加日志（每行一个事件）
+  QFile logFile(m_dataPath + "/generated_tweets.log");
+  int replayed = 0;
+  if (logFile.open(QIODevice::ReadOnly)) {
+    while (!logFile.atEnd()) {
+      QByteArray line = logFile.readLine().trimmed();
+      if (line.isEmpty()) {
+        continue;
+      }
+      // 崩溃时最后一行可能只写了一半，解析失败直接跳过
+      QJsonObject event = QJsonDocument::fromJson(line).object();
+      QString op = event["op"].toString();
+      int id = event["id"].toInt();
+      if (op == "add") {
+        if (id <= 0 || indexById.contains(id)) {
+          continue;
+        }
+        indexById.insert(id, tweets.size());
+        tweets.append(GeneratedTweet::fromJson(event, id));
+      } else if (op == "status") {
+        auto it = indexById.constFind(id);
+        if (it == indexById.constEnd()) {
+          continue;
+        }
+        tweets[it.value()].status =
+            GeneratedTweet::statusFromString(event["status"].toString());
+      } else {
+        continue;
+      }
+      replayed++;
+    }
+    logFile.close();
+  }
+
+  // 3. 有日志或旧格式时压缩为新快照，然后清空日志
+  m_generatedLogEvents = replayed;
+  if (replayed > 0 || needsCompact) {
+    saveGeneratedTweetsSnapshot(tweets);
+    xfInfo(lcStorage) << "Generated tweets compacted:" << tweets.size()
+                      << "tweets," << replayed << "log events replayed";
+  }
+
+  return tweets;
+}
+
+void DataStorage::appendGeneratedTweet(const GeneratedTweet &tweet) {
+  QJsonObject event = tweet.toJson();
+  event["op"] = "add";
+  appendGeneratedTweetEvent(event);
+}
+
+void DataStorage::appendGeneratedTweetStatus(int id,
+                                             GeneratedTweet::Status status) {
+  QJsonObject event;
+  event["op"] = "status";
+  event["id"] = id;
+  event["status"] = GeneratedTweet::statusKey(status);
+  event["time"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+  appendGeneratedTweetEvent(event);
+}
+
+void DataStorage::appendGeneratedTweetEvent(const QJsonObject &event) {
+  QFile file(m_dataPath + "/generated_tweets.log");
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+    xfWarning(lcStorage) << "Failed to open generated_tweets.log";
+    return;
+  }
+  file.write(QJsonDocument(event).toJson(QJsonDocument::Compact) + '\n');
   file.close();
-  if (doc.isArray()) {
-    return doc.array();
+
+  // 长时间运行时日志不无限增长：满一定条数就重放并压缩成新快照
+  if (++m_generatedLogEvents >= GENERATED_LOG_COMPACT_EVENTS) {
+    loadGeneratedTweets();
   }
-  return QJsonArray();
 }
 
-void DataStorage::saveGeneratedTweets(const QJsonArray &tweets) {
+void DataStorage::saveGeneratedTweetsSnapshot(
+    const QList<GeneratedTweet> &tweets) {
   QString filePath = m_dataPath + "/generated_tweets.json";
-  QFile file(filePath);
-  if (file.open(QIODevice::WriteOnly)) {
-    file.write(QJsonDocument(tweets).toJson());
-    file.close();
+  QString tmpPath = filePath + ".tmp";
+
+  QJsonArray arr;
+  for (const auto &tweet : tweets) {
+    arr.append(tweet.toJson());
+  }
+
+  QFile tmpFile(tmpPath);
+  if (!tmpFile.open(QIODevice::WriteOnly)) {
+    xfWarning(lcStorage) << "Failed to create temp file:" << tmpPath;
+    return;
+  }
+  tmpFile.write(QJsonDocument(arr).toJson());
+  tmpFile.close();
+
+  // 备份原文件后原子替换
+  QString bakPath = filePath + ".bak";
+  if (QFile::exists(filePath)) {
+    QFile::remove(bakPath);
+    if (!QFile::rename(filePath, bakPath)) {
+      xfWarning(lcStorage) << "Failed to backup generated_tweets.json";
+      QFile::remove(tmpPath);
+      return;
+    }
+  }
+  if (!QFile::rename(tmpPath, filePath)) {
+    xfWarning(lcStorage)
+        << "Failed to rename temp file to generated_tweets.json";
+    if (QFile::exists(bakPath)) {
+      QFile::rename(bakPath, filePath);
+    }
+    return;
   }
+
+  // 快照替换成功后才清空日志，失败时日志仍可在下次启动重放
+  QFile::remove(m_dataPath + "/generated_tweets.log");
+  m_generatedLogEvents = 0;
 }
 
 QJsonArray DataStorage::loadTweetTemplates() {
@@ -504,12 +667,12 @@ QJsonArray DataStorage::loadTweetTemplates() {
     QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
     file.close();
     if (doc.isArray()) {
-      qDebug() << "[INFO] Loaded" << doc.array().size()
-               << "tweet templates from" << filePath;
+      xfInfo(lcStorage) << "Loaded" << doc.array().size()
+                        << "tweet templates from" << filePath;
       return doc.array();
     }
   }
-  qDebug() << "[WARN] tweet_templates.json not found in any search path";
+  xfWarning(lcStorage) << "tweet_templates.json not found in any search path";
   return QJsonArray();
 }
 
@@ -535,3 +698,48 @@ void DataStorage::savePendingFollowBackUsers(const QJsonArray &users) {
     file.close();
   }
 }
+
+QJsonArray DataStorage::loadFollowerSources() {
+  QFile file(m_dataPath + "/followers_sources.json");
+  if (!file.open(QIODevice::ReadOnly)) {
+    return QJsonArray();
+  }
+  QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+  file.close();
+  return doc.isArray() ? doc.array() : QJsonArray();
+}
+
+void DataStorage::saveFollowerSources(const QJsonArray &sources) {
+  QFile file(m_dataPath + "/followers_sources.json");
+  if (file.open(QIODevice::WriteOnly)) {
+    file.write(QJsonDocument(sources).toJson());
+    file.close();
+  }
+}
+
+QJsonObject DataStorage::loadFollowerSnapshot() {
+  QFile file(m_dataPath + "/follower_snapshot.json");
+  if (!file.open(QIODevice::ReadOnly)) {
+    return QJsonObject();
+  }
+  QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+  file.close();
+  return doc.isObject() ? doc.object() : QJsonObject();
+}
+
+void DataStorage::saveFollowerSnapshot(const QJsonObject &snapshot) {
+  // 先写临时文件再替换，写入中断时保留上一份快照
+  QString filePath = m_dataPath + "/follower_snapshot.json";
+  QString tmpPath = filePath + ".tmp";
+  QFile tmpFile(tmpPath);
+  if (!tmpFile.open(QIODevice::WriteOnly)) {
+    xfWarning(lcStorage) << "Failed to create temp file:" << tmpPath;
+    return;
+  }
+  tmpFile.write(QJsonDocument(snapshot).toJson(QJsonDocument::Compact));
+  tmpFile.close();
+  QFile::remove(filePath);
+  if (!QFile::rename(tmpPath, filePath)) {
+    xfWarning(lcStorage) << "Failed to rename temp file to follower_snapshot.json";
+  }
+}
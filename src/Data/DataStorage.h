@@ -1,6 +1,7 @@
 #ifndef DATASTORAGE_H
 #define DATASTORAGE_H
 
+#include "GeneratedTweet.h"
 #include "Keyword.h"
 #include "Post.h"
 #include <QJsonObject>
@@ -29,17 +30,27 @@ public:
   void savePosts(const QList<Post> &posts);
   void addPost(const Post &post);
   void updatePost(const Post &post);
+  void addPosts(const QList<Post> &posts);    // 批量添加，只调度一次保存
+  void updatePosts(const QList<Post> &posts); // 批量更新，一次遍历缓存
   bool postExists(const QString &postId);
   void flushPosts(); // 强制保存到磁盘
 
   // 回关追踪数据管理
   QSet<QString> loadUsedFollowBackHandles();
   void saveUsedFollowBackHandles(const QSet<QString> &handles);
-  QJsonArray loadGeneratedTweets(); // [{text, status}]
-  void saveGeneratedTweets(const QJsonArray &tweets);
+  // 生成的帖子：快照 generated_tweets.json + 追加日志 generated_tweets.log
+  // 启动时加载快照并重放日志，然后压缩为新快照；运行期追加日志，
+  // 日志满 GENERATED_LOG_COMPACT_EVENTS 条时同样压缩一次
+  QList<GeneratedTweet> loadGeneratedTweets();
+  void appendGeneratedTweet(const GeneratedTweet &tweet);
+  void appendGeneratedTweetStatus(int id, GeneratedTweet::Status status);
   QJsonArray loadTweetTemplates();         // [{header, footer}]
   QJsonArray loadPendingFollowBackUsers(); // [{handle, responseSeconds, ...}]
   void savePendingFollowBackUsers(const QJsonArray &users);
+  QJsonArray loadFollowerSources(); // 粉丝采集来源记录 [{handle, lastVisit, ...}]
+  void saveFollowerSources(const QJsonArray &sources);
+  QJsonObject loadFollowerSnapshot(); // 回关探测粉丝快照 {version, followers}
+  void saveFollowerSnapshot(const QJsonObject &snapshot);
 
   // 配置管理
   QJsonObject loadConfig();
@@ -67,6 +78,8 @@ private:
   void loadPostsToCache();
   void savePostsFromCache();
   void scheduleSave();
+  void saveGeneratedTweetsSnapshot(const QList<GeneratedTweet> &tweets);
+  void appendGeneratedTweetEvent(const QJsonObject &event);
 
   QString m_dataPath;           // 数据目录 (%LOCALAPPDATA%/xfollowing/data)
   QString m_profilePath;        // 浏览器配置目录 (exe目录/userdata/default)
@@ -80,6 +93,9 @@ private:
   bool m_postsDirty = false;             // 是否有未保存的修改
   QTimer *m_saveTimer;                   // 延迟保存定时器
   static const int SAVE_DELAY_MS = 5000; // 5秒延迟
+
+  int m_generatedLogEvents = 0; // generated_tweets.log 当前的事件数
+  static const int GENERATED_LOG_COMPACT_EVENTS = 500;
 };
 
 #endif // DATASTORAGE_H
@@ -0,0 +1,136 @@
+#include "FollowerSnapshot.h"
+#include <QJsonArray>
+#include <algorithm>
+
+QVector<FollowerEntry> FollowerSnapshot::normalize(const QStringList &handles,
+                                                   const QDateTime &now) {
+  QVector<FollowerEntry> seen;
+  seen.reserve(handles.size());
+  for (const auto &handle : handles) {
+    if (!handle.isEmpty()) {
+      seen.append({handle.toLower(), handle, now, now});
+    }
+  }
+  std::sort(seen.begin(), seen.end(),
+            [](const FollowerEntry &a, const FollowerEntry &b) {
+              return a.key < b.key;
+            });
+  auto last = std::unique(seen.begin(), seen.end(),
+                          [](const FollowerEntry &a, const FollowerEntry &b) {
+                            return a.key == b.key;
+                          });
+  seen.erase(last, seen.end());
+  return seen;
+}
+
+FollowerSnapshot::Diff
+FollowerSnapshot::mergeSorted(const QVector<FollowerEntry> &seen,
+                              bool dropMissing) {
+  Diff diff;
+  QVector<FollowerEntry> merged;
+  merged.reserve(m_entries.size() + seen.size());
+
+  int i = 0;
+  int j = 0;
+  while (i < m_entries.size() || j < seen.size()) {
+    if (j >= seen.size() ||
+        (i < m_entries.size() && m_entries[i].key < seen[j].key)) {
+      // 本次没看到
+      if (dropMissing) {
+        diff.lost.append(m_entries[i].handle);
+      } else {
+        merged.append(m_entries[i]);
+      }
+      i++;
+    } else if (i >= m_entries.size() || seen[j].key < m_entries[i].key) {
+      // 新粉丝
+      diff.added.append(seen[j].handle);
+      merged.append(seen[j]);
+      j++;
+    } else {
+      FollowerEntry entry = m_entries[i];
+      entry.handle = seen[j].handle; // 用户可能改过大小写
+      entry.lastSeen = seen[j].lastSeen;
+      merged.append(entry);
+      i++;
+      j++;
+    }
+  }
+
+  m_entries.swap(merged);
+  return diff;
+}
+
+FollowerSnapshot::Diff FollowerSnapshot::merge(const QStringList &handles,
+                                               const QDateTime &now) {
+  return mergeSorted(normalize(handles, now), false);
+}
+
+FollowerSnapshot::Diff FollowerSnapshot::replace(const QStringList &handles,
+                                                 const QDateTime &now) {
+  Diff diff = mergeSorted(normalize(handles, now), true);
+  m_completeTime = now;
+  return diff;
+}
+
+const FollowerEntry *FollowerSnapshot::find(const QString &handle) const {
+  QString key = handle.toLower();
+  auto it = std::lower_bound(
+      m_entries.cbegin(), m_entries.cend(), key,
+      [](const FollowerEntry &entry, const QString &k) { return entry.key < k; });
+  if (it == m_entries.cend() || it->key != key) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+void FollowerSnapshot::clear() {
+  m_entries.clear();
+  m_completeTime = QDateTime();
+}
+
+QJsonObject FollowerSnapshot::toJson() const {
+  QJsonArray followers;
+  for (const auto &entry : m_entries) {
+    QJsonObject obj;
+    obj["handle"] = entry.handle;
+    obj["firstSeen"] = entry.firstSeen.toString(Qt::ISODate);
+    obj["lastSeen"] = entry.lastSeen.toString(Qt::ISODate);
+    followers.append(obj);
+  }
+
+  QJsonObject obj;
+  obj["version"] = VERSION;
+  obj["completeTime"] = m_completeTime.toString(Qt::ISODate);
+  obj["followers"] = followers;
+  return obj;
+}
+
+bool FollowerSnapshot::fromJson(const QJsonObject &obj) {
+  clear();
+  if (obj["version"].toInt() != VERSION) {
+    return false;
+  }
+
+  QJsonArray followers = obj["followers"].toArray();
+  m_entries.reserve(followers.size());
+  for (const auto &v : followers) {
+    QJsonObject item = v.toObject();
+    QString handle = item["handle"].toString();
+    if (handle.isEmpty()) {
+      continue;
+    }
+    m_entries.append(
+        {handle.toLower(), handle,
+         QDateTime::fromString(item["firstSeen"].toString(), Qt::ISODate),
+         QDateTime::fromString(item["lastSeen"].toString(), Qt::ISODate)});
+  }
+  // 文件按 key 有序写出，手工编辑过的文件这里重新排序
+  std::sort(m_entries.begin(), m_entries.end(),
+            [](const FollowerEntry &a, const FollowerEntry &b) {
+              return a.key < b.key;
+            });
+  m_completeTime =
+      QDateTime::fromString(obj["completeTime"].toString(), Qt::ISODate);
+  return true;
+}
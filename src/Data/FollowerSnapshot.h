@@ -0,0 +1,58 @@
+#ifndef FOLLOWERSNAPSHOT_H
+#define FOLLOWERSNAPSHOT_H
+
+#include <QDateTime>
+#include <QJsonObject>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// 粉丝快照条目
+struct FollowerEntry {
+  QString key;         // 小写 handle（排序键）
+  QString handle;      // 页面上的原始大小写
+  QDateTime firstSeen; // 第一次出现在粉丝列表的时间
+  QDateTime lastSeen;  // 最近一次出现的时间
+};
+
+// 粉丝快照（回关探测，持久化到 follower_snapshot.json）
+// 条目按小写 handle 有序存放，查询用二分查找。
+// 每次观察到的一组 handle 先排序去重，再和快照做一次线性归并得到差异：
+//   - merge():   部分可见（探测页顶部的一屏），只产生新增，看不到的不算消失
+//   - replace(): 完整扫描，产生新增和消失，消失的条目移除
+class FollowerSnapshot {
+public:
+  struct Diff {
+    QStringList added; // 原始大小写
+    QStringList lost;
+    bool isEmpty() const { return added.isEmpty() && lost.isEmpty(); }
+  };
+
+  Diff merge(const QStringList &handles, const QDateTime &now);
+  Diff replace(const QStringList &handles, const QDateTime &now);
+
+  bool contains(const QString &handle) const { return find(handle) != nullptr; }
+  const FollowerEntry *find(const QString &handle) const;
+  int size() const { return m_entries.size(); }
+  bool isEmpty() const { return m_entries.isEmpty(); }
+  void clear();
+
+  // 最近一次完整扫描（replace）的时间
+  QDateTime completeTime() const { return m_completeTime; }
+
+  QJsonObject toJson() const;
+  // 版本不符或格式错误时清空并返回 false
+  bool fromJson(const QJsonObject &obj);
+
+  static const int VERSION = 1;
+
+private:
+  static QVector<FollowerEntry> normalize(const QStringList &handles,
+                                          const QDateTime &now);
+  Diff mergeSorted(const QVector<FollowerEntry> &seen, bool dropMissing);
+
+  QVector<FollowerEntry> m_entries; // 按 key 升序
+  QDateTime m_completeTime;
+};
+
+#endif // FOLLOWERSNAPSHOT_H
@@ -0,0 +1,80 @@
+#ifndef GENERATEDTWEET_H
+#define GENERATEDTWEET_H
+
+#include <QString>
+#include <QDateTime>
+#include <QJsonObject>
+#include <QJsonValue>
+
+struct GeneratedTweet {
+    enum class Status {
+        Pending,   // 未处理
+        Published, // 已发布
+        Skipped    // 已跳过
+    };
+
+    int id = 0;                        // 序号（从1开始，列表显示为 #id）
+    QString text;                      // 帖子内容
+    Status status = Status::Pending;   // 处理状态
+    QDateTime createdAt;               // 生成时间
+
+    // 界面显示用的状态文字
+    static QString statusLabel(Status status) {
+        switch (status) {
+        case Status::Published:
+            return QString::fromUtf8("\xe5\xb7\xb2\xe5\x8f\x91\xe5\xb8\x83"); // 已发布
+        case Status::Skipped:
+            return QString::fromUtf8("\xe5\xb7\xb2\xe8\xb7\xb3\xe8\xbf\x87"); // 已跳过
+        default:
+            return QString::fromUtf8("\xe6\x9c\xaa\xe5\xa4\x84\xe7\x90\x86"); // 未处理
+        }
+    }
+
+    // 持久化用的状态键（与界面文字解耦）
+    static QString statusKey(Status status) {
+        switch (status) {
+        case Status::Published:
+            return "published";
+        case Status::Skipped:
+            return "skipped";
+        default:
+            return "pending";
+        }
+    }
+
+    // 兼容旧数据：旧版直接存中文状态文字
+    static Status statusFromString(const QString& value) {
+        if (value == "published" || value == statusLabel(Status::Published))
+            return Status::Published;
+        if (value == "skipped" || value == statusLabel(Status::Skipped))
+            return Status::Skipped;
+        return Status::Pending;
+    }
+
+    QJsonObject toJson() const {
+        QJsonObject obj;
+        obj["id"] = id;
+        obj["text"] = text;
+        obj["status"] = statusKey(status);
+        obj["createdAt"] = createdAt.toString(Qt::ISODate);
+        return obj;
+    }
+
+    // 兼容最早的纯字符串格式和 {text, status(中文), createdAt} 格式
+    static GeneratedTweet fromJson(const QJsonValue& value, int fallbackId) {
+        GeneratedTweet tweet;
+        tweet.id = fallbackId;
+        if (value.isString()) {
+            tweet.text = value.toString();
+            return tweet;
+        }
+        QJsonObject obj = value.toObject();
+        tweet.id = obj["id"].toInt(fallbackId);
+        tweet.text = obj["text"].toString();
+        tweet.status = statusFromString(obj["status"].toString());
+        tweet.createdAt = QDateTime::fromString(obj["createdAt"].toString(), Qt::ISODate);
+        return tweet;
+    }
+};
+
+#endif // GENERATEDTWEET_H
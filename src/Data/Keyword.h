@@ -11,6 +11,28 @@ struct Keyword {
     bool isEnabled = true;     // 是否启用
     int matchCount = 0;        // 匹配次数
 
+    // 产出统计（累计值，用于界面展示）
+    int pageLoads = 0;         // 搜索页加载次数
+    int newAccounts = 0;       // 发现的新账号数
+    int duplicateHits = 0;     // 重复出现的已知账号数
+    int followedCount = 0;     // 由该关键词采集并已关注的账号数
+    int followBackCount = 0;   // 其中被回关的账号数
+
+    // 折扣统计（每次搜索页加载按比例衰减，用于调度，反映近期产出）
+    double recentLoads = 0.0;
+    double recentNewAccounts = 0.0;
+
+    double yieldPerLoad() const {
+        return pageLoads > 0 ? double(newAccounts) / pageLoads : 0.0;
+    }
+    double duplicateRate() const {
+        int seen = newAccounts + duplicateHits;
+        return seen > 0 ? double(duplicateHits) / seen : 0.0;
+    }
+    double followBackRate() const {
+        return followedCount > 0 ? double(followBackCount) / followedCount : 0.0;
+    }
+
     Keyword() {
         id = QUuid::createUuid().toString(QUuid::WithoutBraces);
     }
@@ -25,6 +47,13 @@ struct Keyword {
         obj["text"] = text;
         obj["isEnabled"] = isEnabled;
         obj["matchCount"] = matchCount;
+        obj["pageLoads"] = pageLoads;
+        obj["newAccounts"] = newAccounts;
+        obj["duplicateHits"] = duplicateHits;
+        obj["followedCount"] = followedCount;
+        obj["followBackCount"] = followBackCount;
+        obj["recentLoads"] = recentLoads;
+        obj["recentNewAccounts"] = recentNewAccounts;
         return obj;
     }
 
@@ -34,6 +63,13 @@ struct Keyword {
         kw.text = obj["text"].toString();
         kw.isEnabled = obj["isEnabled"].toBool(true);
         kw.matchCount = obj["matchCount"].toInt(0);
+        kw.pageLoads = obj["pageLoads"].toInt(0);
+        kw.newAccounts = obj["newAccounts"].toInt(0);
+        kw.duplicateHits = obj["duplicateHits"].toInt(0);
+        kw.followedCount = obj["followedCount"].toInt(0);
+        kw.followBackCount = obj["followBackCount"].toInt(0);
+        kw.recentLoads = obj["recentLoads"].toDouble(0.0);
+        kw.recentNewAccounts = obj["recentNewAccounts"].toDouble(0.0);
         return kw;
     }
 };
@@ -0,0 +1,211 @@
+#include "SearchIndex.h"
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+// 墓碑数量超过该值且多于存活文档时压缩
+const int COMPACT_MIN_DEAD = 1024;
+
+// n-gram 编码：高 8 位存 n，低 48 位存最多 3 个 UTF-16 码元
+inline quint64 gramKey(const QChar *p, int n) {
+  quint64 key = quint64(n) << 56;
+  for (int i = 0; i < n; ++i) {
+    key |= quint64(p[i].unicode()) << (16 * (n - 1 - i));
+  }
+  return key;
+}
+
+} // namespace
+
+void SearchIndex::clear() {
+  m_docByPostId.clear();
+  m_docPostIds.clear();
+  m_docTexts.clear();
+  m_postings.clear();
+  m_deadCount = 0;
+}
+
+void SearchIndex::build(const QList<Post> &posts) {
+  clear();
+  m_docPostIds.reserve(posts.size());
+  m_docTexts.reserve(posts.size());
+  for (const auto &post : posts) {
+    if (post.postId.isEmpty() || m_docByPostId.contains(post.postId)) {
+      continue;
+    }
+    insertDoc(post.postId, indexText(post));
+  }
+}
+
+void SearchIndex::addOrUpdate(const Post &post) {
+  if (post.postId.isEmpty()) {
+    return;
+  }
+
+  QString text = indexText(post);
+  auto it = m_docByPostId.constFind(post.postId);
+  if (it != m_docByPostId.constEnd()) {
+    // 关注状态等变化不影响索引文本，直接跳过
+    if (m_docTexts[it.value()] == text) {
+      return;
+    }
+    remove(post.postId);
+  }
+  insertDoc(post.postId, text);
+}
+
+void SearchIndex::remove(const QString &postId) {
+  auto it = m_docByPostId.find(postId);
+  if (it == m_docByPostId.end()) {
+    return;
+  }
+
+  // 只打墓碑，倒排表里的文档ID在查询时过滤
+  int docId = it.value();
+  m_docByPostId.erase(it);
+  m_docPostIds[docId].clear();
+  m_docTexts[docId].clear();
+  m_deadCount++;
+
+  if (m_deadCount > COMPACT_MIN_DEAD && m_deadCount > m_docByPostId.size()) {
+    compact();
+  }
+}
+
+QVector<int> SearchIndex::query(const QString &text) const {
+  QVector<int> result;
+  QString q = text.trimmed().toLower();
+  if (q.isEmpty()) {
+    return result;
+  }
+
+  // 单字符：没有可用的 n-gram，线性扫描
+  if (q.size() == 1) {
+    for (int i = 0; i < m_docTexts.size(); ++i) {
+      if (!m_docPostIds[i].isEmpty() && m_docTexts[i].contains(q)) {
+        result.append(i);
+      }
+    }
+    return result;
+  }
+
+  int n = q.size() >= 3 ? 3 : 2;
+  QVector<quint64> grams = collectGrams(q, n);
+
+  // 取出所有倒排表，按长度从短到长求交
+  QVector<const QVector<int> *> lists;
+  lists.reserve(grams.size());
+  for (quint64 gram : grams) {
+    auto it = m_postings.constFind(gram);
+    if (it == m_postings.constEnd()) {
+      return result; // 任何一个 n-gram 不存在则无结果
+    }
+    lists.append(&it.value());
+  }
+  std::sort(lists.begin(), lists.end(),
+            [](const QVector<int> *a, const QVector<int> *b) {
+              return a->size() < b->size();
+            });
+
+  QVector<int> candidates = *lists.first();
+  QVector<int> merged;
+  for (int i = 1; i < lists.size() && !candidates.isEmpty(); ++i) {
+    merged.clear();
+    std::set_intersection(candidates.constBegin(), candidates.constEnd(),
+                          lists[i]->constBegin(), lists[i]->constEnd(),
+                          std::back_inserter(merged));
+    candidates.swap(merged);
+  }
+
+  // 查询正好是一个 n-gram 时倒排表就是精确结果，否则需要原文校验
+  bool needVerify = q.size() > n;
+  result.reserve(candidates.size());
+  for (int docId : candidates) {
+    if (m_docPostIds[docId].isEmpty()) {
+      continue; // 已删除
+    }
+    if (needVerify && !m_docTexts[docId].contains(q)) {
+      continue;
+    }
+    result.append(docId);
+  }
+  return result;
+}
+
+QSet<QString> SearchIndex::matchingPostIds(const QString &text) const {
+  QVector<int> docs = query(text);
+  QSet<QString> ids;
+  ids.reserve(docs.size());
+  for (int docId : docs) {
+    ids.insert(m_docPostIds[docId]);
+  }
+  return ids;
+}
+
+QString SearchIndex::indexText(const Post &post) {
+  // 字段之间用换行分隔，跨字段的 n-gram 不会被收录
+  return ("@" + post.authorHandle + '\n' + post.authorName + '\n' +
+          post.content + '\n' + post.matchedKeyword)
+      .toLower();
+}
+
+QVector<quint64> SearchIndex::collectGrams(const QString &text, int n) {
+  QVector<quint64> grams;
+  const QChar *data = text.constData();
+  int len = text.size();
+  if (len < n) {
+    return grams;
+  }
+
+  grams.reserve(len - n + 1);
+  for (int i = 0; i + n <= len; ++i) {
+    bool crossField = false;
+    for (int j = 0; j < n; ++j) {
+      if (data[i + j] == QLatin1Char('\n')) {
+        crossField = true;
+        break;
+      }
+    }
+    if (!crossField) {
+      grams.append(gramKey(data + i, n));
+    }
+  }
+
+  // 同一文档内去重，保证倒排表中每个文档只出现一次
+  std::sort(grams.begin(), grams.end());
+  grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+  return grams;
+}
+
+void SearchIndex::insertDoc(const QString &postId, const QString &text) {
+  // 新文档ID单调递增，直接追加即可保持倒排表有序
+  int docId = m_docPostIds.size();
+  m_docPostIds.append(postId);
+  m_docTexts.append(text);
+  m_docByPostId.insert(postId, docId);
+
+  for (int n = 2; n <= 3; ++n) {
+    for (quint64 gram : collectGrams(text, n)) {
+      m_postings[gram].append(docId);
+    }
+  }
+}
+
+void SearchIndex::compact() {
+  QVector<QString> postIds;
+  QVector<QString> texts;
+  postIds.reserve(m_docByPostId.size());
+  texts.reserve(m_docByPostId.size());
+  for (int i = 0; i < m_docPostIds.size(); ++i) {
+    if (!m_docPostIds[i].isEmpty()) {
+      postIds.append(m_docPostIds[i]);
+      texts.append(m_docTexts[i]);
+    }
+  }
+
+  clear();
+  for (int i = 0; i < postIds.size(); ++i) {
+    insertDoc(postIds[i], texts[i]);
+  }
+}
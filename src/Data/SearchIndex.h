@@ -0,0 +1,48 @@
+#ifndef SEARCHINDEX_H
+#define SEARCHINDEX_H
+
+#include "Post.h"
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <QVector>
+
+// 帖子全文检索索引（内存倒排索引）
+// 对 @handle / 显示名 / 内容 / 匹配关键词 的小写文本建立 2-gram 和 3-gram
+// 倒排表，不需要分词即可检索"互关""回关"这类中文短词：
+//   - 查询 >= 3 个字符：三元组倒排表求交，再用原文校验
+//   - 查询 2 个字符：直接命中二元组倒排表
+//   - 查询 1 个字符：退化为线性扫描
+// 增删改都是增量的；删除只打墓碑，墓碑过多时整体压缩重建
+class SearchIndex {
+public:
+  void clear();
+  void build(const QList<Post> &posts);  // 全量重建
+  void addOrUpdate(const Post &post);    // 增量添加/更新（文本未变化时跳过）
+  void remove(const QString &postId);    // 增量删除
+  bool contains(const QString &postId) const {
+    return m_docByPostId.contains(postId);
+  }
+
+  QVector<int> query(const QString &text) const; // 匹配的文档ID（升序）
+  QSet<QString> matchingPostIds(const QString &text) const;
+  QString postIdOf(int docId) const { return m_docPostIds.value(docId); }
+
+  int size() const { return m_docByPostId.size(); }
+  int gramCount() const { return m_postings.size(); }
+
+private:
+  static QString indexText(const Post &post);
+  static QVector<quint64> collectGrams(const QString &text, int n);
+  void insertDoc(const QString &postId, const QString &text);
+  void compact();
+
+  QHash<QString, int> m_docByPostId;       // postId -> 文档ID
+  QVector<QString> m_docPostIds;           // 文档ID -> postId（已删除为空）
+  QVector<QString> m_docTexts;             // 文档ID -> 小写索引文本
+  QHash<quint64, QVector<int>> m_postings; // n-gram -> 升序文档ID列表
+  int m_deadCount = 0;                     // 墓碑数量
+};
+
+#endif // SEARCHINDEX_H
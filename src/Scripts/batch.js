@@ -0,0 +1,50 @@
+// 结果批量上报（搜索监控、粉丝采集共用，放在各脚本前面）
+// 扫描结果先攒进批次，满 maxItems 条或距第一条 intervalMs 后一次性 emit，
+// 单条消息不超过 maxBytes（按 UTF-8 估算），超出时先发出已攒的部分；
+// C++ 端每条消息按一个事务处理（一次排序、一次界面刷新、一次保存调度）
+(function() {
+    if (window.xfollowingBatcher) return;
+
+    const encoder = new TextEncoder();
+
+    window.xfollowingBatcher = function(type, options) {
+        const intervalMs = options && options.intervalMs || 1000;
+        const maxItems = options && options.maxItems || 50;
+        const maxBytes = options && options.maxBytes || 64 * 1024;
+
+        let items = [];
+        let bytes = 0;
+        let timer = 0;
+
+        function flush() {
+            if (timer) {
+                clearTimeout(timer);
+                timer = 0;
+            }
+            if (items.length === 0) return;
+            const batch = items;
+            items = [];
+            bytes = 0;
+            xfollowing.emit(type, batch);
+        }
+
+        function push(item) {
+            const size = encoder.encode(JSON.stringify(item)).length + 1;
+            if (items.length > 0 && bytes + size > maxBytes) {
+                flush();
+            }
+            items.push(item);
+            bytes += size;
+            if (items.length >= maxItems || bytes >= maxBytes) {
+                flush();
+            } else if (!timer) {
+                timer = setTimeout(flush, intervalMs);
+            }
+        }
+
+        // 页面离开前把攒着的结果发出去
+        window.addEventListener('pagehide', flush);
+
+        return { push: push, flush: flush };
+    };
+})();
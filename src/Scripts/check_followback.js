@@ -0,0 +1,103 @@
+// 检查对方是否关注我（AutoFollower，页面加载后注入）
+(function() {
+    const pathParts = window.location.pathname.split('/');
+    const userHandle = pathParts[1] || '';
+    const steps = window.xfollowingSteps('check');
+
+    function checkIfAccountSuspended() {
+        const bodyText = document.body.innerText.toLowerCase();
+        if (bodyText.includes('account suspended') || bodyText.includes('this account has been suspended')) {
+            return true;
+        }
+        return false;
+    }
+
+    function checkIfFollowsMe() {
+        // 检查是否有"Follows you"标签
+        const spans = document.querySelectorAll('span');
+        for (const span of spans) {
+            const text = span.innerText.toLowerCase();
+            if (text === 'follows you' || text === '正在关注你' || text === '关注了你') {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    function checkIfIAmFollowing() {
+        // 检查我是否正在关注对方（有Following/正在关注按钮）
+        const buttons = document.querySelectorAll('[role="button"]');
+        for (const btn of buttons) {
+            const ariaLabel = (btn.getAttribute('aria-label') || '').toLowerCase();
+            const btnText = (btn.innerText || '').toLowerCase();
+            // 排除 Subscribe 按钮
+            if (btnText === 'subscribe' || btnText.startsWith('subscribe') || ariaLabel.includes('subscribe')) {
+                continue;
+            }
+            if (ariaLabel.startsWith('unfollow ')) {
+                return true;
+            }
+            const testId = btn.getAttribute('data-testid');
+            if (testId && testId.includes('-unfollow') && !btnText.includes('subscri')) {
+                return true;
+            }
+            if (btnText === 'following' || btnText === '正在关注') {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    function hasRelationButton() {
+        // 关注/正在关注按钮已渲染（关系状态可以判断了）
+        return checkIfIAmFollowing() ||
+               document.querySelector('[data-testid$="-follow"]') !== null;
+    }
+
+    function hasUserProfile() {
+        return document.querySelector('[data-testid="UserDescription"]') ||
+               document.querySelector('[data-testid="UserProfileHeader_Items"]') ||
+               document.querySelector('[data-testid="UserName"]');
+    }
+
+    function report(type, result) {
+        steps.finish(result);
+        xfollowing.emit(type, userHandle);
+    }
+
+    async function checkPage() {
+        // 资料区或封禁提示出现即可判断，最多等10秒
+        await xfollowingWaitFor(() => hasUserProfile() || checkIfAccountSuspended(), 10000);
+        steps.mark('profile');
+
+        // 检查账号是否被封禁
+        if (checkIfAccountSuspended()) {
+            console.log('[XFOLLOW] Account is suspended');
+            report('CHECK_SUSPENDED', 'suspended');
+            return;
+        }
+
+        // 关系按钮在资料区之后渲染，等它出现再判断
+        await xfollowingWaitFor(hasRelationButton, 5000);
+        steps.mark('button');
+
+        // 检查我是否关注了对方
+        if (!checkIfIAmFollowing()) {
+            console.log('[XFOLLOW] Not following this user, skip check');
+            report('CHECK_NOT_FOLLOWING', 'notFollowing');
+            return;
+        }
+
+        // 检查对方是否回关我
+        if (checkIfFollowsMe()) {
+            console.log('[XFOLLOW] User follows me back');
+            report('CHECK_FOLLOWS_BACK', 'followsBack');
+        } else {
+            console.log('[XFOLLOW] User does NOT follow me back');
+            report('CHECK_NOT_FOLLOW_BACK', 'notFollowBack');
+        }
+    }
+
+    console.log('[XFOLLOW] Check follow-back script injected');
+    checkPage();
+})();
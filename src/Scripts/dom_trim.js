@@ -0,0 +1,105 @@
+// 长时间不导航的时间线页面的 DOM 收缩（搜索监控、粉丝采集、回关探测共用，放在各脚本前面）
+// 已处理的帖子/用户节点交给 track()，滚到视口上方 keepAbovePx 以外时折叠：
+// content-visibility: hidden 加上按原高度的 contain-intrinsic-size，子树不再参与样式和布局计算，
+// 页面高度和滚动位置不变；节点回到视口附近（向上滚动、快照结束回到顶部）时恢复。
+// 节点归页面的 React 管理，直接摘除会让它后续的更新出错，所以只折叠不移除；
+// 页面自己移除的节点在定时检查时放掉引用。
+// 每分钟上报一次 DOM 节点数和 JS 堆大小（METRIC dom）
+(function() {
+    if (window.xfollowingDomTrimmer) return;
+
+    const trimmers = new Map();
+
+    window.xfollowingDomTrimmer = function(role, options) {
+        // 重复注入时沿用同一个，已跟踪的节点不丢
+        if (trimmers.has(role)) return trimmers.get(role);
+
+        const keepAbovePx = options && options.keepAbovePx || 3000;
+
+        const tracked = new Set();
+        const collapsed = new Set();
+        let collapses = 0;
+        let restores = 0;
+        let released = 0;
+
+        function collapse(node, height) {
+            if (collapsed.has(node) || height <= 0) return;
+            collapsed.add(node);
+            collapses++;
+            node.style.containIntrinsicSize = 'auto ' + Math.round(height) + 'px';
+            node.style.contentVisibility = 'hidden';
+        }
+
+        function restore(node) {
+            if (!collapsed.delete(node)) return;
+            restores++;
+            node.style.contentVisibility = '';
+            node.style.containIntrinsicSize = '';
+        }
+
+        // 视口上下各扩 keepAbovePx：离开这个范围且在上方的折叠，重新进入的恢复
+        const observer = new IntersectionObserver(entries => {
+            for (const entry of entries) {
+                const node = entry.target;
+                if (entry.isIntersecting) {
+                    restore(node);
+                } else if (entry.rootBounds && entry.boundingClientRect.bottom < entry.rootBounds.top) {
+                    collapse(node, entry.boundingClientRect.height);
+                }
+            }
+        }, { rootMargin: keepAbovePx + 'px 0px ' + keepAbovePx + 'px 0px' });
+
+        const trimmer = {
+            track(node) {
+                if (tracked.has(node)) return;
+                tracked.add(node);
+                observer.observe(node);
+            },
+            has(node) {
+                return tracked.has(node);
+            },
+            // 页面（虚拟列表、重新渲染）已移除的节点不再观察，避免引用一直留着
+            prune() {
+                for (const node of tracked) {
+                    if (!node.isConnected) {
+                        observer.unobserve(node);
+                        tracked.delete(node);
+                        collapsed.delete(node);
+                        released++;
+                    }
+                }
+            },
+            stats() {
+                const memory = performance.memory;
+                const stats = {
+                    name: 'dom',
+                    role: role,
+                    nodes: document.getElementsByTagName('*').length,
+                    tracked: tracked.size,
+                    collapsed: collapsed.size,
+                    collapses: collapses,
+                    restores: restores,
+                    released: released
+                };
+                if (memory) {
+                    stats.heapKb = Math.round(memory.usedJSHeapSize / 1024);
+                    stats.heapTotalKb = Math.round(memory.totalJSHeapSize / 1024);
+                }
+                collapses = 0;
+                restores = 0;
+                released = 0;
+                return stats;
+            }
+        };
+        trimmers.set(role, trimmer);
+        return trimmer;
+    };
+
+    // 每分钟检查一次已移除的节点，并上报 DOM 规模
+    setInterval(() => {
+        for (const trimmer of trimmers.values()) {
+            trimmer.prune();
+            xfollowing.emit('METRIC', trimmer.stats());
+        }
+    }, 60000);
+})();
@@ -0,0 +1,74 @@
+// 帖子节点单次遍历提取（搜索页监控使用，bench/ExtractorBench.html 对比旧的逐项 querySelector 实现）
+window.xfollowingExtractArticle = (function() {
+    // 正则和系统路径只创建一次，不在每条帖子、每个链接里重建
+    const HANDLE_PATH = /^\/[a-zA-Z0-9_]+$/;
+    const SYSTEM_PATHS = new Set(['home', 'explore', 'notifications', 'messages', 'i', 'settings', 'search', 'compose']);
+    const VERIFIED_LABELS = new Set(['Verified account', '已认证帐号']);
+
+    // 一次 TreeWalker 遍历收集作者、蓝V徽章、正文、时间、状态链接和@提及，
+    // 顺序与原先 querySelector 的文档顺序一致（取第一个匹配）
+    return function extractArticle(article) {
+        let statusHref = '';
+        let timeElement = null;
+        let textElement = null;
+        let verified = false;
+        const tweetTexts = [];
+        const handleLinks = [];
+
+        const walker = document.createTreeWalker(article, NodeFilter.SHOW_ELEMENT);
+        for (let node = walker.currentNode; node; node = walker.nextNode()) {
+            const name = node.localName;
+            if (name === 'a') {
+                const href = node.getAttribute('href');
+                if (href) {
+                    if (!statusHref && href.includes('/status/')) {
+                        statusHref = href;
+                    } else if (HANDLE_PATH.test(href)) {
+                        handleLinks.push(node);
+                    }
+                }
+            } else if (name === 'time') {
+                if (!timeElement) timeElement = node;
+            }
+
+            const testId = node.getAttribute('data-testid');
+            if (testId === 'tweetText') {
+                tweetTexts.push(node);
+                if (!textElement) textElement = node;
+            } else if (testId === 'icon-verified') {
+                verified = true;
+            }
+            if (!verified && VERIFIED_LABELS.has(node.getAttribute('aria-label'))) {
+                verified = true;
+            }
+        }
+
+        const postId = statusHref ? statusHref.split('/status/')[1].split('?')[0] : '';
+        const authorLink = handleLinks[0];
+        const authorHandle = authorLink ? authorLink.getAttribute('href').substring(1) : '';
+
+        // @提及：排除系统链接、作者自己、重复用户；只收集@开头的文本链接或正文里的链接（排除头像等）
+        const mentionedUsers = [];
+        for (const link of handleLinks) {
+            const handle = link.getAttribute('href').substring(1);
+            if (handle === authorHandle || SYSTEM_PATHS.has(handle) || mentionedUsers.includes(handle)) {
+                continue;
+            }
+            if (link.textContent.startsWith('@') || tweetTexts.some(text => text.contains(link))) {
+                mentionedUsers.push(handle);
+            }
+        }
+
+        return {
+            postId: postId,
+            postUrl: postId ? 'https://x.com' + statusHref : '',
+            postTime: timeElement ? timeElement.getAttribute('datetime') || '' : '',
+            authorHandle: authorHandle,
+            authorName: authorLink ? authorLink.textContent || authorHandle : '',
+            verified: verified,
+            // 正文 innerText 需要布局信息，由调用方在确认是蓝V后再读取
+            textElement: textElement,
+            mentionedUsers: mentionedUsers
+        };
+    };
+})();
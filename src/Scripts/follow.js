@@ -0,0 +1,350 @@
+// 用户主页自动关注（AutoFollower，页面加载后注入）
+(function() {
+    const pathParts = window.location.pathname.split('/');
+    const userHandle = pathParts[1] || '';
+    let retryCount = 0;
+    const maxRetries = 2;
+    const steps = window.xfollowingSteps('follow');
+
+    function checkIfSensitiveContentWarning() {
+        // 检查是否是敏感内容警告页面
+        const bodyText = document.body.innerText.toLowerCase();
+        if (bodyText.includes('caution: this profile may include potentially sensitive content') ||
+            bodyText.includes('potentially sensitive images or language') ||
+            bodyText.includes('yes, view profile')) {
+            return true;
+        }
+        return false;
+    }
+
+    function clickViewProfileButton() {
+        // 点击"Yes, view profile"按钮
+        const buttons = document.querySelectorAll('button, [role="button"]');
+        for (const btn of buttons) {
+            const text = btn.innerText.toLowerCase();
+            if (text.includes('yes, view profile') || text === 'yes, view profile') {
+                console.log('[XFOLLOW] Clicking "Yes, view profile" button...');
+                btn.click();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    function checkIfAccountSuspended() {
+        // 检查账号是否被封禁或受限
+        const bodyText = document.body.innerText.toLowerCase();
+
+        // 注意：敏感内容警告不算账号被封禁，需要单独处理
+        if (checkIfSensitiveContentWarning()) {
+            return false;  // 不是封禁，是敏感内容警告
+        }
+
+        // 检查是否是受保护账户（These posts are protected）
+        const protectedHeader = document.querySelector('[data-testid="empty_state_header_text"]');
+        if (protectedHeader && protectedHeader.innerText.toLowerCase().includes('protected')) {
+            console.log('[XFOLLOW] Detected: protected account');
+            return true;
+        }
+        if (bodyText.includes('these posts are protected') ||
+            bodyText.includes('only approved followers can see')) {
+            console.log('[XFOLLOW] Detected: protected account');
+            return true;
+        }
+
+        // 检查各种限制状态（使用精确的完整短语）
+        const restrictionKeywords = [
+            'account suspended',
+            'this account has been suspended',
+            'caution: this account is temporarily restricted',
+            'this account is temporarily restricted',
+            'account has been withheld',
+            'this account is suspended',
+            'account withheld in'
+        ];
+
+        for (const keyword of restrictionKeywords) {
+            if (bodyText.includes(keyword)) {
+                console.log('[XFOLLOW] Detected restriction: ' + keyword);
+                return true;
+            }
+        }
+
+        // 专门检测"账号不存在"页面（更精确的检测）
+        // 这个页面通常同时包含这两个短语
+        if (bodyText.includes('this account doesn') && bodyText.includes('exist')) {
+            console.log('[XFOLLOW] Detected: account does not exist');
+            return true;
+        }
+        if (bodyText.includes('try searching for another')) {
+            console.log('[XFOLLOW] Detected: try searching for another');
+            return true;
+        }
+
+        return false;
+    }
+
+    function checkIfUserFollowsMe() {
+        // 检查对方是否已经关注我（显示 "Follows you"）
+        const spans = document.querySelectorAll('span');
+        for (const span of spans) {
+            const text = span.innerText.toLowerCase();
+            if (text === 'follows you' || text === '正在关注你' || text === '关注了你') {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    function checkIfOwnProfile() {
+        // 检查是否是自己的页面（有编辑资料按钮）
+        const editProfileLink = document.querySelector('a[href="/settings/profile"]') ||
+                                document.querySelector('a[href*="/settings/profile"]');
+        if (editProfileLink) {
+            return true;
+        }
+
+        // 检查是否有"Edit profile"或"编辑个人资料"按钮
+        const buttons = document.querySelectorAll('a, button, [role="button"]');
+        for (const btn of buttons) {
+            const text = btn.innerText.toLowerCase();
+            if (text === 'edit profile' || text === '编辑个人资料' || text === 'set up profile') {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    function checkIfFollowing() {
+        // 检查是否已经变成Following状态
+        const buttons = document.querySelectorAll('[role="button"]');
+
+        for (const btn of buttons) {
+            const ariaLabel = (btn.getAttribute('aria-label') || '').toLowerCase();
+            const btnText = (btn.innerText || '').toLowerCase();
+
+            // 排除 Subscribe 按钮（订阅类用户的 Subscribe 有 -unfollow testId）
+            if (btnText === 'subscribe' || btnText.startsWith('subscribe') || ariaLabel.includes('subscribe')) {
+                continue;
+            }
+
+            // aria-label 精确匹配 "Unfollow @xxx"
+            if (ariaLabel.startsWith('unfollow ')) {
+                return true;
+            }
+
+            // 检查是否已经关注（Following状态）
+            const testId = btn.getAttribute('data-testid');
+            if (testId && testId.includes('-unfollow') && !btnText.includes('subscri')) {
+                return true;
+            }
+            if (btnText === 'following' || btnText === '正在关注') {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    function checkIfSubscribeOnly() {
+        // 检查是否只有Subscribe按钮（付费订阅用户，没有Follow按钮）
+        const buttons = document.querySelectorAll('[role="button"], button');
+        let hasSubscribe = false;
+        let hasFollow = false;
+
+        for (const btn of buttons) {
+            const btnText = btn.innerText.toLowerCase().trim();
+            // 检测Subscribe按钮（包括带价格的如"Subscribe - SGD 13.40/mo"）
+            if (btnText === 'subscribe' || btnText.startsWith('subscribe')) {
+                hasSubscribe = true;
+            }
+            // 检测Follow按钮
+            if (btnText === 'follow' || btnText === 'follow back' || btnText === '关注' || btnText === '回关') {
+                hasFollow = true;
+            }
+        }
+
+        // 如果有Subscribe但没有Follow，说明是纯付费订阅用户
+        return hasSubscribe && !hasFollow;
+    }
+
+    function findFollowButton() {
+        // 查找关注按钮
+        const buttons = document.querySelectorAll('[role="button"]');
+
+        for (const btn of buttons) {
+            const testId = btn.getAttribute('data-testid');
+
+            // 检查是否是关注按钮（未关注状态）
+            if (testId && testId.includes('-follow') && !testId.includes('-unfollow')) {
+                const btnText = btn.innerText.toLowerCase();
+                // 兼容 "Follow" 和 "Follow back" 按钮
+                if (btnText === 'follow' || btnText === '关注' || btnText === 'follow back' || btnText === '回关') {
+                    return btn;
+                }
+            }
+        }
+        return null;
+    }
+
+    function hasUserProfile() {
+        return document.querySelector('[data-testid="UserDescription"]') ||
+               document.querySelector('[data-testid="UserProfileHeader_Items"]') ||
+               document.querySelector('[data-testid="UserName"]');
+    }
+
+    function report(type, result) {
+        steps.finish(result);
+        xfollowing.emit(type, userHandle);
+    }
+
+    async function findAndClickFollow() {
+        // 先检查账号是否被封禁
+        if (checkIfAccountSuspended()) {
+            console.log('[XFOLLOW] Account is suspended, skipping...');
+            report('ACCOUNT_SUSPENDED', 'suspended');
+            return;
+        }
+
+        // 检查是否是付费订阅用户（只有Subscribe按钮）
+        if (checkIfSubscribeOnly()) {
+            console.log('[XFOLLOW] Subscribe-only user, skipping...');
+            report('ACCOUNT_SUSPENDED', 'subscribeOnly');  // 使用相同的跳过逻辑，不计入失败
+            return;
+        }
+
+        // 检查是否是自己的页面
+        if (checkIfOwnProfile()) {
+            report('ALREADY_FOLLOWING', 'ownProfile');
+            return;
+        }
+
+        // 检查是否已经是Following状态
+        if (checkIfFollowing()) {
+            report('ALREADY_FOLLOWING', 'alreadyFollowing');
+            return;
+        }
+
+        // 检查对方是否已经关注我（先关注我的用户，直接关注回去）
+        if (checkIfUserFollowsMe()) {
+            console.log('[XFOLLOW] User already follows me, will follow back');
+            // 继续执行关注操作，不跳过
+        }
+
+        const btn = findFollowButton();
+        if (btn) {
+            console.log('[XFOLLOW] Found follow button, clicking... (attempt ' + (retryCount + 1) + ')');
+            btn.click();
+
+            // 按钮变成 Following 即成功，最多等5秒
+            await xfollowingWaitFor(checkIfFollowing, 5000);
+            steps.mark('verify');
+            verifyFollowSuccess();
+        } else {
+            // 没找到按钮
+            if (checkIfOwnProfile()) {
+                report('ALREADY_FOLLOWING', 'ownProfile');
+            } else if (checkIfFollowing()) {
+                // 已经是关注状态
+                report('ALREADY_FOLLOWING', 'alreadyFollowing');
+            } else if (hasUserProfile()) {
+                // 用户页面已加载但没有关注按钮（可能用户关闭了关注功能）
+                console.log('[XFOLLOW] Profile loaded but no follow button available, skipping...');
+                report('ACCOUNT_SUSPENDED', 'noButton');  // 跳过，不计入失败
+            } else {
+                report('FOLLOW_FAILED', 'noProfile');
+            }
+        }
+    }
+
+    async function verifyFollowSuccess() {
+        if (checkIfFollowing()) {
+            // 成功关注
+            report('FOLLOW_SUCCESS', 'success');
+            return;
+        }
+        // 关注失败，尝试重试
+        retryCount++;
+        if (retryCount <= maxRetries) {
+            console.log('[XFOLLOW] Follow not confirmed, retrying... (' + retryCount + '/' + maxRetries + ')');
+            await xfollowingSleep(1500);
+            findAndClickFollow();
+        } else {
+            // 重试次数用完，报告失败
+            console.log('[XFOLLOW] Follow failed after ' + maxRetries + ' retries');
+            report('FOLLOW_FAILED', 'notVerified');
+        }
+    }
+
+    // 页面状态：敏感内容警告 / 封禁或不存在 / 自己的主页 / 可以关注；都不是返回 null
+    function pageState() {
+        if (document.readyState !== 'complete') return null;
+        if (checkIfSensitiveContentWarning()) return 'sensitive';
+        if (checkIfAccountSuspended()) return 'suspended';
+        if (checkIfOwnProfile()) return 'own';
+
+        // 用户信息（头像/名字/简介）已加载且有关注按钮
+        const hasAvatar = document.querySelector('[data-testid="UserAvatar-Container-unknown"]') ||
+                          document.querySelector('a[href="/' + userHandle + '/photo"]') ||
+                          document.querySelector('[data-testid="UserName"]');
+        const hasFollowButton = findFollowButton() !== null || checkIfFollowing();
+        if ((hasAvatar || hasUserProfile()) && hasFollowButton) return 'ready';
+        return null;
+    }
+
+    // 等待页面完全加载（DOM 变化驱动，就绪即继续，最多15秒）
+    async function waitForPageReady() {
+        let state = await xfollowingWaitFor(pageState, 15000);
+
+        // 敏感内容警告：点击查看后重新等待
+        for (let clicks = 0; state === 'sensitive' && clicks < 3; clicks++) {
+            console.log('[XFOLLOW] Detected sensitive content warning, clicking view profile...');
+            if (!clickViewProfileButton()) break;
+            steps.mark('sensitive');
+            state = await xfollowingWaitFor(() => {
+                const s = pageState();
+                return s === 'sensitive' ? null : s;
+            }, 15000);
+        }
+        steps.mark('ready');
+
+        if (state === 'suspended') {
+            console.log('[XFOLLOW] Account suspended/not exist, skipping...');
+            report('ACCOUNT_SUSPENDED', 'suspended');
+            return;
+        }
+        if (state === 'own') {
+            console.log('[XFOLLOW] This is own profile, skipping...');
+            report('ALREADY_FOLLOWING', 'ownProfile');
+            return;
+        }
+        if (state === 'ready') {
+            // 按钮刚渲染时点击偶尔不生效，稍等片刻（点击后仍有验证和重试）
+            await xfollowingSleep(500);
+            findAndClickFollow();
+            return;
+        }
+
+        // 超时时再次检查账号状态
+        if (checkIfAccountSuspended()) {
+            console.log('[XFOLLOW] Account suspended/not exist (timeout), skipping...');
+            report('ACCOUNT_SUSPENDED', 'suspended');
+        } else if (checkIfSubscribeOnly()) {
+            console.log('[XFOLLOW] Subscribe-only user (timeout), skipping...');
+            report('ACCOUNT_SUSPENDED', 'subscribeOnly');
+        } else if (checkIfFollowing()) {
+            console.log('[XFOLLOW] Already following (timeout)');
+            report('ALREADY_FOLLOWING', 'alreadyFollowing');
+        } else if (hasUserProfile() && !findFollowButton()) {
+            // 页面加载了用户信息但没有关注按钮
+            console.log('[XFOLLOW] Profile loaded but no follow button (timeout), skipping...');
+            report('ACCOUNT_SUSPENDED', 'noButton');
+        } else {
+            console.log('[XFOLLOW] Page load timeout, trying anyway...');
+            findAndClickFollow();
+        }
+    }
+
+    // 开始等待页面加载
+    console.log('[XFOLLOW] Auto-follow script injected, waiting for page to load...');
+    waitForPageReady();
+})();
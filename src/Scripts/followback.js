@@ -0,0 +1,139 @@
+// 回关探测：扫描自己的 verified_followers（文档开始脚本，PostMonitor 注册）
+(function() {
+    // 避免重复注入
+    if (window.xfollowingFollowBackObserver) return;
+
+    if (!window.xfollowingFollowBackIds) {
+        window.xfollowingFollowBackIds = window.xfollowingIdCache('followback', 3000);
+    }
+
+    // 处理过的用户滚远后折叠（dom_trim.js），快照滚动整个粉丝列表时布局开销不随列表增长
+    const trimmer = window.xfollowingDomTrimmer('followback');
+    const armedAt = performance.now();
+    let firstDetectionReported = false;
+
+    // 粉丝快照：由 C++ 调用 xfollowing.startSnapshot() 触发，滚动整个列表，
+    // 把见到的全部 handle 分批发给 C++（虚拟列表滚过的节点会被移除，只能边滚边收集）
+    let snapshot = null;
+    let scanned = new WeakSet();
+    const snapshotBatch = window.xfollowingBatcher('FOLLOWBACK_SNAPSHOT', { intervalMs: 1000, maxItems: 200 });
+    const SNAPSHOT_STEP_MS = 1200;
+    const SNAPSHOT_IDLE_STEPS = 5;   // 到底且连续这么多步没有新用户，认为列表已完整
+    const SNAPSHOT_MAX_STEPS = 1500; // 上限（约30分钟），超出按不完整处理
+
+    xfollowing.startSnapshot = function() {
+        if (snapshot) return;
+        snapshot = new Set();
+        scanned = new WeakSet();
+        let steps = 0;
+        let idleSteps = 0;
+        let lastSize = 0;
+        scheduleScan();
+
+        const timer = setInterval(() => {
+            steps++;
+            const atBottom = window.innerHeight + window.scrollY >= document.documentElement.scrollHeight - 10;
+            if (snapshot.size === lastSize && atBottom) {
+                idleSteps++;
+            } else {
+                idleSteps = 0;
+            }
+            lastSize = snapshot.size;
+
+            // 列表为空（未登录或加载失败）或超过上限时结束，标记为不完整
+            const empty = steps >= SNAPSHOT_IDLE_STEPS && snapshot.size === 0;
+            const complete = idleSteps >= SNAPSHOT_IDLE_STEPS && snapshot.size > 0;
+            if (complete || empty || steps >= SNAPSHOT_MAX_STEPS) {
+                clearInterval(timer);
+                snapshotBatch.flush();
+                xfollowing.emit('FOLLOWBACK_SNAPSHOT_DONE', { complete: complete, count: snapshot.size, steps: steps });
+                console.log('[XFOLLOW] Follower snapshot done: ' + snapshot.size + ' users, complete=' + complete);
+                snapshot = null;
+                window.scrollTo(0, 0);
+                return;
+            }
+            window.scrollBy(0, window.innerHeight * 2);
+        }, SNAPSHOT_STEP_MS);
+    };
+
+    function scanMyFollowers() {
+        // 查找用户列表中的所有用户单元格
+        const userCells = document.querySelectorAll('[data-testid="UserCell"]');
+        const detectedFollowers = [];
+
+        if (userCells.length > 0 && !firstDetectionReported) {
+            firstDetectionReported = true;
+            xfollowing.emit('METRIC', {
+                name: 'firstDetection',
+                role: 'followback',
+                ms: Math.round(performance.now()),
+                armedMs: Math.round(armedAt),
+                nodes: userCells.length
+            });
+        }
+
+        userCells.forEach(cell => {
+            // 已处理过的节点（可能已折叠）跳过；快照开始时 scanned 清空，全部重新收集
+            if (scanned.has(cell)) return;
+
+            const userLinks = cell.querySelectorAll('a[href^="/"]');
+            let userHandle = '';
+            let userName = '';
+
+            for (const link of userLinks) {
+                const href = link.getAttribute('href');
+                if (href && href.match(/^\/[a-zA-Z0-9_]+$/) && !href.includes('/status/')) {
+                    userHandle = href.substring(1);
+                    const nameSpan = link.querySelector('span');
+                    userName = nameSpan ? nameSpan.innerText : userHandle;
+                    break;
+                }
+            }
+
+            if (userHandle) {
+                scanned.add(cell);
+                trimmer.track(cell);
+            }
+
+            if (userHandle && snapshot && !snapshot.has(userHandle)) {
+                snapshot.add(userHandle);
+                snapshotBatch.push(userHandle);
+            }
+
+            // 快照扫描期间只走 FOLLOWBACK_SNAPSHOT：滚过的都是老粉丝，不能当成新回关上报
+            if (userHandle && !snapshot && !window.xfollowingFollowBackIds.has(userHandle)) {
+                window.xfollowingFollowBackIds.add(userHandle);
+                detectedFollowers.push({
+                    handle: userHandle,
+                    name: userName,
+                    detectedTime: new Date().toISOString()
+                });
+            }
+        });
+
+        if (detectedFollowers.length > 0) {
+            xfollowing.emit('FOLLOWBACK_DETECTED', detectedFollowers);
+            console.log('[XFOLLOW] Scan: ' + userCells.length + ' cells, ' + detectedFollowers.length + ' new');
+        }
+    }
+
+    // 用户列表节点出现即扫描（合并同一批 DOM 变化），页面不滚动，由C++定时Reload刷新
+    let scanScheduled = false;
+    function scheduleScan() {
+        if (scanScheduled) return;
+        scanScheduled = true;
+        setTimeout(() => {
+            scanScheduled = false;
+            scanMyFollowers();
+        }, 50);
+    }
+
+    window.xfollowingFollowBackObserver = new MutationObserver(scheduleScan);
+    window.xfollowingFollowBackObserver.observe(document, {
+        childList: true,
+        subtree: true
+    });
+    scheduleScan();
+
+    console.log('[XFOLLOW] Follow-back detect script armed');
+})();
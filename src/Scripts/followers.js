@@ -0,0 +1,139 @@
+// 粉丝列表采集（文档开始脚本，PostMonitor 注册）
+(function() {
+    // 避免重复注入
+    if (window.xfollowingFollowersProcessedIds) {
+        // 保留已处理的ID
+    } else {
+        window.xfollowingFollowersProcessedIds = window.xfollowingIdCache('followers', 3000);
+    }
+
+    // 新用户攒批上报（batch.js）：每秒或满50条发一次 NEW_FOLLOWERS
+    const followerBatch = window.xfollowingBatcher('NEW_FOLLOWERS', { intervalMs: 1000, maxItems: 50 });
+    // 处理过的用户滚远后折叠（dom_trim.js）
+    const trimmer = window.xfollowingDomTrimmer('followers');
+    const armedAt = performance.now();
+    let firstDetectionReported = false;
+
+    function parseFollower(userCell) {
+        try {
+            // 获取用户信息
+            const userLinks = userCell.querySelectorAll('a[href^="/"]');
+            let userHandle = '';
+            let userName = '';
+
+            for (const link of userLinks) {
+                const href = link.getAttribute('href');
+                if (href && href.match(/^\/[a-zA-Z0-9_]+$/) && !href.includes('/status/')) {
+                    userHandle = href.substring(1);
+                    // 获取用户名（通常在第一个span中）
+                    const nameSpan = link.querySelector('span');
+                    userName = nameSpan ? nameSpan.innerText : userHandle;
+                    break;
+                }
+            }
+
+            if (!userHandle) return null;
+
+            // 检查是否是蓝V用户
+            const verifiedBadge = userCell.querySelector('[data-testid="icon-verified"]') ||
+                                  userCell.querySelector('svg[aria-label="Verified account"]') ||
+                                  userCell.querySelector('svg[aria-label="已认证帐号"]') ||
+                                  userCell.querySelector('[aria-label="Verified account"]') ||
+                                  userCell.querySelector('[aria-label="已认证帐号"]');
+            if (!verifiedBadge) return null;
+
+            // 检查是否有"Follows you"标签（如果有则跳过）
+            const allSpans = userCell.querySelectorAll('span');
+            for (const span of allSpans) {
+                const text = span.innerText.toLowerCase().trim();
+                if (text === 'follows you' || text.includes('follows you') ||
+                    text === '关注了你' || text.includes('关注了你')) {
+                    return null;  // 已关注我，跳过
+                }
+            }
+
+            return {
+                authorHandle: userHandle,
+                authorName: userName,
+                authorUrl: 'https://x.com/' + userHandle
+            };
+        } catch (e) {
+            console.log('[XFOLLOW] Parse follower error:', e);
+            return null;
+        }
+    }
+
+    function scanFollowers() {
+        // 查找用户列表中的所有用户单元格
+        const userCells = document.querySelectorAll('[data-testid="UserCell"]');
+
+        if (userCells.length > 0 && !firstDetectionReported) {
+            firstDetectionReported = true;
+            xfollowing.emit('METRIC', {
+                name: 'firstDetection',
+                role: 'followers',
+                ms: Math.round(performance.now()),
+                armedMs: Math.round(armedAt),
+                nodes: userCells.length
+            });
+        }
+
+        userCells.forEach(cell => {
+            // 已处理过的节点（可能已折叠）不再逐个查链接
+            if (trimmer.has(cell)) return;
+
+            // 获取用户handle作为唯一标识
+            const userLinks = cell.querySelectorAll('a[href^="/"]');
+            let userHandle = '';
+            for (const link of userLinks) {
+                const href = link.getAttribute('href');
+                if (href && href.match(/^\/[a-zA-Z0-9_]+$/) && !href.includes('/status/')) {
+                    userHandle = href.substring(1);
+                    break;
+                }
+            }
+
+            if (userHandle) {
+                trimmer.track(cell);
+            }
+
+            if (userHandle && !window.xfollowingFollowersProcessedIds.has(userHandle)) {
+                window.xfollowingFollowersProcessedIds.add(userHandle);
+                const follower = parseFollower(cell);
+                if (follower) {
+                    followerBatch.push(follower);
+                }
+            }
+        });
+    }
+
+    // DOM 变化后合并到一次扫描
+    let scanScheduled = false;
+    function scheduleScan() {
+        if (scanScheduled) return;
+        scanScheduled = true;
+        setTimeout(() => {
+            scanScheduled = false;
+            scanFollowers();
+        }, 50);
+    }
+
+    // 兜底定时扫描
+    if (window.xfollowingFollowersInterval) {
+        clearInterval(window.xfollowingFollowersInterval);
+    }
+    window.xfollowingFollowersInterval = setInterval(scanFollowers, 3000);
+
+    // 从文档开始监听，用户列表一出现就扫描
+    if (window.xfollowingFollowersObserver) {
+        window.xfollowingFollowersObserver.disconnect();
+    }
+    window.xfollowingFollowersObserver = new MutationObserver(scheduleScan);
+    window.xfollowingFollowersObserver.observe(document, {
+        childList: true,
+        subtree: true
+    });
+    scheduleScan();
+
+    console.log('[XFOLLOW] Followers monitor script injected');
+})();
@@ -0,0 +1,60 @@
+// 有界的已处理ID缓存（搜索监控、粉丝采集、回关探测共用，放在各脚本前面）
+// 两代 Set 轮换，近似 LRU：新ID写入当前代，当前代写满一半容量时整体降为上一代，
+// 原上一代丢弃（计入淘汰数）；上一代里再次命中的ID提升回当前代。
+// 总量不超过容量，页面长时间不导航内存也保持平稳；被淘汰的ID再次出现时会重新上报，
+// 由 C++ 端（已持久化的帖子/用户列表）做最终去重
+(function() {
+    if (window.xfollowingIdCache) return;
+
+    const caches = [];
+
+    window.xfollowingIdCache = function(name, capacity) {
+        const generationSize = Math.max(1, Math.floor(capacity / 2));
+        let current = new Set();
+        let previous = new Set();
+        let evictions = 0;
+        let rotations = 0;
+
+        const cache = {
+            has(id) {
+                if (current.has(id)) return true;
+                if (previous.delete(id)) {
+                    cache.add(id);
+                    return true;
+                }
+                return false;
+            },
+            add(id) {
+                current.add(id);
+                if (current.size >= generationSize) {
+                    evictions += previous.size;
+                    rotations++;
+                    previous = current;
+                    current = new Set();
+                }
+            },
+            get size() {
+                return current.size + previous.size;
+            },
+            stats() {
+                return { name: 'idCache', role: name, size: cache.size, capacity: capacity,
+                         evictions: evictions, rotations: rotations };
+            }
+        };
+        caches.push(cache);
+        return cache;
+    };
+
+    // 每分钟上报一次各缓存的大小和淘汰数（有变化时）
+    const lastReported = new Map();
+    setInterval(() => {
+        for (const cache of caches) {
+            const stats = cache.stats();
+            const key = stats.size + '/' + stats.evictions;
+            if (lastReported.get(cache) !== key) {
+                lastReported.set(cache, key);
+                xfollowing.emit('METRIC', stats);
+            }
+        }
+    }, 60000);
+})();
@@ -0,0 +1,268 @@
+// 搜索页帖子监控（文档开始脚本，PostMonitor 注册）
+(function() {
+    // 如果已经注入过，先移除旧的
+    if (window.xfollowingObserver) {
+        window.xfollowingObserver.disconnect();
+    }
+    if (window.xfollowingProcessedIds) {
+        // 保留已处理的ID，避免重复
+    } else {
+        // 帖子ID和 mention_<handle>，有界缓存（id_cache.js）
+        window.xfollowingProcessedIds = window.xfollowingIdCache('monitor', 5000);
+    }
+
+    // 关键词自动机由 C++ 编译（KeywordMatcher），xfollowing.setMatcher(...) 热更新，不必重新执行整个脚本
+    let matcher = window.xfollowingMatcher || null;
+    // 脚本在文档开始时（渲染进程 OnContextCreated）执行，document.body 此时还不存在
+    const armedAt = performance.now();
+    let loginReported = false;
+
+    // Aho-Corasick：正文小写一次，逐字符走自动机，一遍得到全部命中的关键词（按关键词列表顺序）
+    function matchKeywords(content) {
+        if (!matcher || matcher.keywords.length === 0) return [];
+        const next = matcher.next;
+        const fail = matcher.fail;
+        const out = matcher.out;
+        const hit = new Array(matcher.keywords.length).fill(false);
+        const text = content.toLowerCase();
+        let state = 0;
+        for (let i = 0; i < text.length; i++) {
+            const ch = text[i];
+            while (state > 0 && next[state][ch] === undefined) {
+                state = fail[state];
+            }
+            state = next[state][ch] || 0;
+            const hits = out[state];
+            if (hits) {
+                for (const k of hits) hit[k] = true;
+            }
+        }
+        return matcher.keywords.filter((kw, k) => hit[k]);
+    }
+
+    // info 来自 xfollowingExtractArticle（extract_post.js）的单次遍历结果
+    function parsePost(info) {
+        try {
+            if (!info.authorHandle) return null;
+
+            // 不是蓝V用户，跳过
+            if (!info.verified) return null;
+
+            // 获取帖子内容
+            const content = info.textElement ? info.textElement.innerText : '';
+
+            if (!content) return null;
+
+            // 检查匹配的关键词（OR 合并查询时一条帖子可能命中多个，全部上报用于归属统计）
+            const matchedKeywords = matchKeywords(content);
+
+            if (matchedKeywords.length === 0) return null;
+
+            return {
+                postId: info.postId,
+                authorHandle: info.authorHandle,
+                authorName: info.authorName,
+                authorUrl: 'https://x.com/' + info.authorHandle,
+                content: content,
+                postUrl: info.postUrl,
+                postTime: info.postTime,
+                matchedKeyword: matchedKeywords[0],
+                matchedKeywords: matchedKeywords,
+                // 帖子中@提及的用户（从整个article中查找，Twitter把"Replying to @user"移到了tweetText外面）
+                mentionedUsers: info.mentionedUsers
+            };
+        } catch (e) {
+            console.log('[XFOLLOW] Parse error:', e);
+            return null;
+        }
+    }
+
+    const ARTICLE_SELECTOR = 'article[data-testid="tweet"]';
+    // 新帖子攒批上报（batch.js）：每秒或满50条发一次 NEW_POSTS
+    const postBatch = window.xfollowingBatcher('NEW_POSTS', { intervalMs: 1000, maxItems: 50 });
+    // 处理过的帖子滚远后折叠（dom_trim.js），页面挂一整天样式和布局开销也不随帖子数增长
+    const trimmer = window.xfollowingDomTrimmer('monitor');
+
+    function reportArticlesSeen(count) {
+        // 页面上有帖子，说明用户已登录
+        if (!loginReported) {
+            loginReported = true;
+            xfollowing.emit('USER_LOGGED_IN');
+        }
+        // 首次检测耗时（从导航开始计，performance.now() 的时间原点），关键词更新重新执行时不再上报
+        if (!window.xfollowingFirstDetectionReported) {
+            window.xfollowingFirstDetectionReported = true;
+            xfollowing.emit('METRIC', {
+                name: 'firstDetection',
+                role: 'monitor',
+                ms: Math.round(performance.now()),
+                armedMs: Math.round(armedAt),
+                nodes: count
+            });
+        }
+    }
+
+    function processArticle(article) {
+        const info = window.xfollowingExtractArticle(article);
+        const postId = info.postId;
+        // 还没渲染出帖子链接的节点不跟踪，之后的整页重扫仍会处理
+        if (postId) {
+            trimmer.track(article);
+        }
+
+        if (postId && !window.xfollowingProcessedIds.has(postId)) {
+            window.xfollowingProcessedIds.add(postId);
+            const post = parsePost(info);
+            if (post) {
+                // 添加原帖子作者
+                postBatch.push(post);
+
+                // 为每个@提及的用户创建一条记录
+                if (post.mentionedUsers && post.mentionedUsers.length > 0) {
+                    for (const mentionHandle of post.mentionedUsers) {
+                        // 检查是否已处理过这个用户
+                        const mentionKey = 'mention_' + mentionHandle;
+                        if (!window.xfollowingProcessedIds.has(mentionKey)) {
+                            window.xfollowingProcessedIds.add(mentionKey);
+                            postBatch.push({
+                                postId: post.postId + '_mention_' + mentionHandle,
+                                authorHandle: mentionHandle,
+                                authorName: '@' + mentionHandle,
+                                authorUrl: 'https://x.com/' + mentionHandle,
+                                content: '[被@] 来自 @' + post.authorHandle + ' 的帖子',
+                                postUrl: post.postUrl,
+                                postTime: post.postTime,
+                                matchedKeyword: post.matchedKeyword + ' (被@)',
+                                matchedKeywords: post.matchedKeywords
+                            });
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // 增量处理：MutationObserver 只把新增的帖子节点放进待处理集合，
+    // 空闲时（requestIdleCallback）批量处理；只有关键词变化和兜底定时器才整页查询
+    const pendingArticles = new Set();
+    let fullScanPending = false;
+    let flushScheduled = false;
+    // 扫描耗时统计，随兜底定时器上报（METRIC scan）
+    const scanStats = { batches: 0, articles: 0, fullScans: 0, totalMs: 0, maxMs: 0 };
+
+    function flushPending() {
+        flushScheduled = false;
+        const start = performance.now();
+        let articles;
+        const fullScan = fullScanPending;
+        if (fullScanPending) {
+            fullScanPending = false;
+            pendingArticles.clear();
+            articles = document.querySelectorAll(ARTICLE_SELECTOR);
+            scanStats.fullScans++;
+        } else {
+            articles = Array.from(pendingArticles);
+            pendingArticles.clear();
+        }
+        if (articles.length === 0) return;
+
+        reportArticlesSeen(articles.length);
+        for (const article of articles) {
+            // 虚拟列表可能已把节点移除；整页重扫时跳过已处理（可能已折叠）的节点
+            if (article.isConnected && !(fullScan && trimmer.has(article))) {
+                processArticle(article);
+            }
+        }
+
+        const elapsed = performance.now() - start;
+        scanStats.batches++;
+        scanStats.articles += articles.length;
+        scanStats.totalMs += elapsed;
+        scanStats.maxMs = Math.max(scanStats.maxMs, elapsed);
+    }
+
+    function scheduleFlush() {
+        if (flushScheduled) return;
+        flushScheduled = true;
+        // 后台页面的空闲回调可能迟迟不来，timeout 保证最迟 200ms 处理
+        if (window.requestIdleCallback) {
+            requestIdleCallback(flushPending, { timeout: 200 });
+        } else {
+            setTimeout(flushPending, 50);
+        }
+    }
+
+    // 整页重扫（关键词变化、兜底），同样合并到空闲回调
+    function scheduleScan() {
+        fullScanPending = true;
+        scheduleFlush();
+    }
+
+    function collectArticles(records) {
+        for (const record of records) {
+            for (const node of record.addedNodes) {
+                if (node.nodeType !== Node.ELEMENT_NODE) continue;
+                if (node.matches(ARTICLE_SELECTOR)) {
+                    pendingArticles.add(node);
+                    continue;
+                }
+                // 帖子内部延迟渲染的子节点归到所在帖子
+                const owner = node.closest(ARTICLE_SELECTOR);
+                if (owner) {
+                    pendingArticles.add(owner);
+                } else if (node.firstElementChild) {
+                    for (const article of node.querySelectorAll(ARTICLE_SELECTOR)) {
+                        pendingArticles.add(article);
+                    }
+                }
+            }
+        }
+        if (pendingArticles.size > 0) {
+            scheduleFlush();
+        }
+    }
+
+    function reportScanStats() {
+        if (scanStats.batches === 0) return;
+        xfollowing.emit('METRIC', {
+            name: 'scan',
+            role: 'monitor',
+            batches: scanStats.batches,
+            articles: scanStats.articles,
+            fullScans: scanStats.fullScans,
+            avgMs: Math.round(scanStats.totalMs / scanStats.batches * 100) / 100,
+            maxMs: Math.round(scanStats.maxMs * 100) / 100
+        });
+        scanStats.batches = 0;
+        scanStats.articles = 0;
+        scanStats.fullScans = 0;
+        scanStats.totalMs = 0;
+        scanStats.maxMs = 0;
+    }
+
+    xfollowing.setMatcher = function(compiled) {
+        matcher = compiled && Array.isArray(compiled.keywords) ? compiled : null;
+        window.xfollowingMatcher = matcher;
+        console.log('[XFOLLOW] Keywords updated:', matcher ? matcher.keywords : []);
+        scheduleScan();
+    };
+
+    // 兜底定时扫描 - 每60秒一次（防止漏掉观察器没报告的变化），顺带上报扫描耗时
+    if (window.xfollowingInterval) {
+        clearInterval(window.xfollowingInterval);
+    }
+    window.xfollowingInterval = setInterval(() => {
+        reportScanStats();
+        scheduleScan();
+    }, 60000);
+
+    // 从文档开始监听 DOM 变化，帖子节点一出现就处理
+    window.xfollowingObserver = new MutationObserver(collectArticles);
+    window.xfollowingObserver.observe(document, {
+        childList: true,
+        subtree: true
+    });
+    scheduleScan();
+
+    console.log('[XFOLLOW] Monitor script injected');
+})();
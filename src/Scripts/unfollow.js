@@ -0,0 +1,122 @@
+// 取消关注（AutoFollower，页面加载后注入）
+(function() {
+    const pathParts = window.location.pathname.split('/');
+    const userHandle = pathParts[1] || '';
+    const steps = window.xfollowingSteps('unfollow');
+
+    function findUnfollowButton() {
+        const buttons = document.querySelectorAll('[role="button"]');
+        for (const btn of buttons) {
+            const ariaLabel = (btn.getAttribute('aria-label') || '').toLowerCase();
+            const btnText = (btn.innerText || '').toLowerCase();
+            // 优先用 aria-label 精确匹配 "Unfollow @xxx"
+            if (ariaLabel.startsWith('unfollow ')) {
+                return btn;
+            }
+            // 排除 Subscribe 按钮（订阅类用户的 Subscribe 按钮有 -unfollow testId）
+            if (btnText === 'subscribe' || btnText === '订阅' || ariaLabel.includes('subscribe')) {
+                continue;
+            }
+            if (btnText === 'following' || btnText === '正在关注') {
+                return btn;
+            }
+            // data-testid 兜底，但必须排除 Subscribe
+            const testId = btn.getAttribute('data-testid');
+            if (testId && testId.includes('-unfollow') && !btnText.includes('subscri')) {
+                return btn;
+            }
+        }
+        return null;
+    }
+
+    function findConfirmUnfollowButton() {
+        // 方式1: 标准确认对话框 (普通用户)
+        const buttons = document.querySelectorAll('[role="button"]');
+        for (const btn of buttons) {
+            const testId = btn.getAttribute('data-testid');
+            if (testId === 'confirmationSheetConfirm') {
+                return btn;
+            }
+            const btnText = (btn.innerText || '').toLowerCase();
+            if (btnText === 'unfollow' || btnText === '取消关注') {
+                return btn;
+            }
+        }
+
+        // 方式2: 订阅类用户的弹出菜单 (role="menuitem")
+        const menuItems = document.querySelectorAll('[role="menuitem"]');
+        for (const item of menuItems) {
+            const text = (item.innerText || '').toLowerCase();
+            if (text.includes('unfollow') || text.includes('取消关注')) {
+                return item;
+            }
+        }
+
+        return null;
+    }
+
+    function verifyUnfollowSuccess() {
+        // 检查是否变成了Follow状态
+        const buttons = document.querySelectorAll('[role="button"]');
+        for (const btn of buttons) {
+            const ariaLabel = (btn.getAttribute('aria-label') || '').toLowerCase();
+            const btnText = (btn.innerText || '').toLowerCase();
+            // 排除 Subscribe
+            if (btnText === 'subscribe' || btnText === '订阅') continue;
+            // aria-label 精确匹配
+            if (ariaLabel.startsWith('follow @')) {
+                return true;
+            }
+            const testId = btn.getAttribute('data-testid');
+            if (testId && testId.includes('-follow') && !testId.includes('-unfollow')) {
+                if (btnText === 'follow' || btnText === '关注') {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    function report(type, result) {
+        steps.finish(result);
+        xfollowing.emit(type, userHandle);
+    }
+
+    async function doUnfollow() {
+        // 通常紧接着回关检查执行，页面已就绪时立即找到
+        const btn = await xfollowingWaitFor(findUnfollowButton, 10000);
+        steps.mark('button');
+        if (!btn) {
+            console.log('[XFOLLOW] Following button not found');
+            report('UNFOLLOW_FAILED', 'noButton');
+            return;
+        }
+        console.log('[XFOLLOW] Found Following button, clicking to unfollow...');
+        btn.click();
+
+        // 等待确认对话框或菜单弹出（订阅用户可能慢一点）
+        const confirmBtn = await xfollowingWaitFor(findConfirmUnfollowButton, 5000);
+        steps.mark('confirm');
+        if (!confirmBtn) {
+            console.log('[XFOLLOW] Confirm button not found');
+            report('UNFOLLOW_FAILED', 'noConfirm');
+            return;
+        }
+        console.log('[XFOLLOW] Found confirm button (type: ' + confirmBtn.getAttribute('role') + '), clicking...');
+        confirmBtn.click();
+
+        // 验证取消关注是否成功（按钮变回 Follow）
+        const success = await xfollowingWaitFor(verifyUnfollowSuccess, 5000);
+        steps.mark('verify');
+        if (success) {
+            console.log('[XFOLLOW] Unfollow success');
+            report('UNFOLLOW_SUCCESS', 'success');
+        } else {
+            console.log('[XFOLLOW] Unfollow may have failed');
+            report('UNFOLLOW_FAILED', 'notVerified');
+        }
+    }
+
+    console.log('[XFOLLOW] Unfollow script injected');
+    doUnfollow();
+})();
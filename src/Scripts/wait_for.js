@@ -0,0 +1,102 @@
+// 页面就绪等待（关注、回关检查、取消关注共用，放在各脚本前面）
+// xfollowingWaitFor(condition, timeoutMs)：condition 是选择器或返回真值的函数，
+// 先立即检查一次，之后在 DOM 变化时重新检查（同一批变化合并为一次），
+// 满足时 resolve 为条件的返回值（选择器为找到的元素），超时 resolve 为 null。
+// xfollowingSteps(action)：记录每一步的耗时，finish() 时以 METRIC 上报
+(function() {
+    if (window.xfollowingWaitFor) return;
+
+    const CHECK_DELAY_MS = 100;
+
+    window.xfollowingWaitFor = function(condition, timeoutMs) {
+        const test = typeof condition === 'string'
+            ? () => document.querySelector(condition)
+            : condition;
+
+        return new Promise(resolve => {
+            let done = false;
+            let scheduled = false;
+            let observer = null;
+            let timer = 0;
+
+            function evaluate() {
+                try {
+                    return test() || null;
+                } catch (e) {
+                    return null;
+                }
+            }
+
+            function finish(value) {
+                if (done) return;
+                done = true;
+                if (observer) observer.disconnect();
+                document.removeEventListener('readystatechange', schedule);
+                clearTimeout(timer);
+                resolve(value);
+            }
+
+            function check() {
+                scheduled = false;
+                if (done) return;
+                const value = evaluate();
+                if (value) finish(value);
+            }
+
+            // 一批 DOM 变化只检查一次（部分条件要读 innerText，比较重）
+            function schedule() {
+                if (scheduled || done) return;
+                scheduled = true;
+                setTimeout(check, CHECK_DELAY_MS);
+            }
+
+            check();
+            if (done) return;
+
+            observer = new MutationObserver(schedule);
+            observer.observe(document.documentElement, {
+                childList: true,
+                subtree: true,
+                characterData: true,
+                attributes: true,
+                attributeFilter: ['aria-label', 'data-testid', 'role']
+            });
+            document.addEventListener('readystatechange', schedule);
+            timer = setTimeout(() => finish(evaluate()), timeoutMs);
+        });
+    };
+
+    window.xfollowingSleep = function(ms) {
+        return new Promise(resolve => setTimeout(resolve, ms));
+    };
+
+    // 每一步的耗时（毫秒，同名步骤累加，如关注重试），慢在哪一步从 slowest 字段直接看出
+    window.xfollowingSteps = function(action) {
+        const start = performance.now();
+        let last = start;
+        const steps = new Map();
+
+        return {
+            mark(step) {
+                const now = performance.now();
+                steps.set(step, (steps.get(step) || 0) + Math.round(now - last));
+                last = now;
+            },
+            finish(result) {
+                const metric = {
+                    name: 'steps',
+                    action: action,
+                    result: result,
+                    totalMs: Math.round(performance.now() - start)
+                };
+                let slowest = null;
+                for (const [step, ms] of steps) {
+                    metric[step + 'Ms'] = ms;
+                    if (!slowest || ms > slowest[1]) slowest = [step, ms];
+                }
+                if (slowest) metric.slowest = slowest[0];
+                xfollowing.emit('METRIC', metric);
+            }
+        };
+    };
+})();
@@ -1,11 +1,18 @@
 #include "BrowserWidget.h"
+#include "App/RequestContextRegistry.h"
+#include "Utils/Logger.h"
 #include "include/cef_browser.h"
 #include "include/cef_request_context.h"
 #include "include/cef_request_context_handler.h"
 #include "include/cef_cookie.h"
 #include "include/wrapper/cef_helpers.h"
 #include "include/internal/cef_types_geometry.h"
+#include <QAbstractNativeEventFilter>
+#include <QMouseEvent>
 #include <QResizeEvent>
+#include <QWheelEvent>
+#include <QShowEvent>
+#include <QHideEvent>
 #include <QCloseEvent>
 #include <QMetaObject>
 #include <QPointer>
@@ -25,6 +32,58 @@
 extern void writeLog(const QString& msg);
 
 namespace {
+#ifdef _WIN32
+// CEF 浏览器子窗口里的点击、滚动、按键不经过 Qt 控件；
+// 外部消息泵模式下这些消息仍由 Qt 的事件循环取出，在这里按窗口归到对应的 BrowserWidget
+class BrowserInputFilter : public QAbstractNativeEventFilter {
+public:
+    static BrowserInputFilter& instance() {
+        static BrowserInputFilter* filter = nullptr;
+        if (!filter) {
+            filter = new BrowserInputFilter();
+            QCoreApplication::instance()->installNativeEventFilter(filter);
+        }
+        return *filter;
+    }
+
+    void add(BrowserWidget* widget) { m_widgets.append(widget); }
+    void remove(BrowserWidget* widget) { m_widgets.removeAll(widget); }
+
+    bool nativeEventFilter(const QByteArray& eventType, void* message, qintptr*) override {
+        if (eventType != "windows_dispatcher_MSG") {
+            return false;
+        }
+        const MSG* msg = static_cast<const MSG*>(message);
+        switch (msg->message) {
+            case WM_LBUTTONDOWN:
+            case WM_RBUTTONDOWN:
+            case WM_MBUTTONDOWN:
+            case WM_MOUSEWHEEL:
+            case WM_KEYDOWN:
+            case WM_SYSKEYDOWN:
+                break;
+            default:
+                return false;
+        }
+        for (BrowserWidget* widget : m_widgets) {
+            CefHandler* handler = widget->GetHandler();
+            if (!handler || !handler->GetBrowser()) {
+                continue;
+            }
+            HWND browserHwnd = handler->GetBrowser()->GetHost()->GetWindowHandle();
+            if (browserHwnd && (msg->hwnd == browserHwnd || IsChild(browserHwnd, msg->hwnd))) {
+                widget->NoteUserInput();
+                break;
+            }
+        }
+        return false;
+    }
+
+private:
+    QList<BrowserWidget*> m_widgets;
+};
+#endif
+
 class FlushCallback : public CefCompletionCallback {
 public:
     explicit FlushCallback(QObject* owner, std::function<void()> onDone)
@@ -72,6 +131,9 @@ BrowserWidget::BrowserWidget(QWidget* parent)
         if (m_handler && m_handler->GetBrowser()) {
             m_handler->GetBrowser()->GetHost()->SetZoomLevel(0.0);
             ResizeBrowser();
+            if (!IsOnScreen()) {
+                SetBrowserWindowHidden(true);
+            }
         }
 
         emit browserCreated();
@@ -79,6 +141,7 @@ BrowserWidget::BrowserWidget(QWidget* parent)
     connect(m_handler, &CefHandler::browserClosed, this, [this]() {
         m_browserCreated = false;
         m_browserCreating = false;
+        ReleaseRequestContext();
         if (m_recreatePending) {
             m_recreatePending = false;
             CreateBrowserInternal(m_pendingUrl);
@@ -88,6 +151,14 @@ BrowserWidget::BrowserWidget(QWidget* parent)
     connect(m_handler, &CefHandler::loadFinished, this, &BrowserWidget::loadFinished);
     connect(m_handler, &CefHandler::titleChanged, this, &BrowserWidget::titleChanged);
     connect(m_handler, &CefHandler::urlChanged, this, &BrowserWidget::urlChanged);
+    // 页面加载算作活动；记录最后的 URL 供释放后恢复
+    connect(m_handler, &CefHandler::loadStarted, this, [this]() { m_idleClock.restart(); });
+    connect(m_handler, &CefHandler::loadFinished, this, [this]() { m_idleClock.restart(); });
+    connect(m_handler, &CefHandler::urlChanged, this, [this](const QString& url) {
+        if (!url.isEmpty() && !url.startsWith("about:")) {
+            m_lastUrl = url;
+        }
+    });
     connect(m_handler, &CefHandler::jsResultReceived, this, [this](const QString& result) {
         writeLog(QString("[BROWSERWIDGET] Received JS result, len=%1").arg(result.length()));
         emit jsResultReceived(result);
@@ -114,13 +185,44 @@ BrowserWidget::BrowserWidget(QWidget* parent)
     connect(m_handler, &CefHandler::userLoggedIn, this, &BrowserWidget::userLoggedIn);
     // 回关探测信号转发
     connect(m_handler, &CefHandler::followBackDetected, this, &BrowserWidget::followBackDetected);
+    connect(m_handler, &CefHandler::followerSnapshotReceived, this, &BrowserWidget::followerSnapshotReceived);
+    connect(m_handler, &CefHandler::followerSnapshotDone, this, &BrowserWidget::followerSnapshotDone);
+    connect(m_handler, &CefHandler::apiResponseCaptured, this, &BrowserWidget::apiResponseCaptured);
+
+    // 省电：定期检查可见性/空闲，定期采样渲染进程 CPU/内存
+    m_idleClock.start();
+    m_userInputClock.start();
+#ifdef _WIN32
+    BrowserInputFilter::instance().add(this);
+#endif
+    m_usageClock.start();
+    m_powerTimer = new QTimer(this);
+    m_powerTimer->setInterval(POWER_TICK_MS);
+    connect(m_powerTimer, &QTimer::timeout, this, &BrowserWidget::OnPowerTick);
+    m_powerTimer->start();
+    m_usageTimer = new QTimer(this);
+    m_usageTimer->setInterval(USAGE_REPORT_MS);
+    connect(m_usageTimer, &QTimer::timeout, this, &BrowserWidget::SampleUsage);
+    m_usageTimer->start();
 }
 
 BrowserWidget::~BrowserWidget() {
+#ifdef _WIN32
+    BrowserInputFilter::instance().remove(this);
+#endif
     if (m_handler && m_handler->GetBrowser()) {
         m_handler->GetBrowser()->GetHost()->CloseBrowser(true);
     }
     m_handler = nullptr;
+    ReleaseRequestContext();
+}
+
+void BrowserWidget::ReleaseRequestContext() {
+    if (m_requestContext) {
+        m_requestContext = nullptr;
+        RequestContextRegistry::release(m_contextProfilePath);
+    }
+    m_contextProfilePath.clear();
 }
 
 void BrowserWidget::CreateBrowser(const QString& url) {
@@ -156,6 +258,24 @@ void BrowserWidget::SwitchProfile(const QString& url, const QString& profilePath
     CreateBrowserInternal(url);
 }
 
+void BrowserWidget::SetStartupScript(const QString& role, const std::string& script) {
+    if (m_handler) {
+        m_handler->SetStartupScript(role, script);
+    }
+}
+
+void BrowserWidget::SetStartupPrelude(const std::string& prelude) {
+    if (m_handler) {
+        m_handler->SetStartupPrelude(prelude);
+    }
+}
+
+void BrowserWidget::SetResourcePolicy(const QString& label, const ResourcePolicy& policy) {
+    if (m_handler) {
+        m_handler->SetResourcePolicy(label, policy);
+    }
+}
+
 void BrowserWidget::CreateBrowserInternal(const QString& url) {
     if (m_browserCreated) {
         LoadUrl(url);
@@ -201,23 +321,14 @@ void BrowserWidget::CreateBrowserInternal(const QString& url) {
     browserSettings.javascript_access_clipboard = STATE_ENABLED;
     browserSettings.javascript_dom_paste = STATE_ENABLED;
 
-    if (m_profilePath.isEmpty()) {
-        m_requestContext = nullptr;
-    } else {
-        QDir profileDir(m_profilePath);
-        if (!profileDir.exists()) {
-            profileDir.mkpath(".");
-        }
-
-        QString absolutePath = QDir::toNativeSeparators(profileDir.absolutePath());
-
-        CefRequestContextSettings contextSettings;
-        CefString(&contextSettings.cache_path).FromWString(absolutePath.toStdWString());
-        contextSettings.persist_session_cookies = true;
-        m_requestContext = CefRequestContext::CreateContext(contextSettings, nullptr);
-    }
+    // 同一 profile 的浏览器共享一个请求上下文（网络会话/Cookie/缓存）
+    ReleaseRequestContext();
+    m_requestContext = RequestContextRegistry::acquire(m_profilePath);
+    m_contextProfilePath = m_profilePath;
 
     m_browserCreating = true;
+    m_powerState = PowerState::Active;
+    m_idleClock.restart();
 
     m_handler->SetParentHwnd(parentHwnd);
 
@@ -226,7 +337,7 @@ void BrowserWidget::CreateBrowserInternal(const QString& url) {
         m_handler,
         url.toStdString(),
         browserSettings,
-        nullptr,
+        m_handler->CreateExtraInfo(),
         m_requestContext
     );
 }
@@ -253,18 +364,37 @@ void BrowserWidget::DisconnectAll() {
 }
 
 void BrowserWidget::LoadUrl(const QString& url) {
+    if (m_powerState == PowerState::Discarded) {
+        RestorePage(url);
+        return;
+    }
+    MarkActivity();
     if (m_handler && m_handler->GetBrowser()) {
         m_handler->GetBrowser()->GetMainFrame()->LoadURL(url.toStdString());
     }
 }
 
 void BrowserWidget::ExecuteJavaScript(const QString& code) {
+    ExecuteJavaScript(code.toStdString());
+}
+
+void BrowserWidget::ExecuteJavaScript(const std::string& code) {
+    if (m_powerState == PowerState::Discarded) {
+        xfWarning(lcCef) << "[POWER]" << m_powerLabel << "page discarded, script skipped";
+        return;
+    }
+    MarkActivity();
     if (m_handler) {
         m_handler->ExecuteJavaScript(code);
     }
 }
 
 void BrowserWidget::Reload() {
+    if (m_powerState == PowerState::Discarded) {
+        RestorePage(m_lastUrl);
+        return;
+    }
+    MarkActivity();
     if (m_handler && m_handler->GetBrowser()) {
         m_handler->GetBrowser()->Reload();
     }
@@ -302,6 +432,31 @@ void BrowserWidget::CloseDevTools() {
 void BrowserWidget::resizeEvent(QResizeEvent* event) {
     QWidget::resizeEvent(event);
     ResizeBrowser();
+
+    // 分栏折叠/展开时立即切换，不等空闲检查
+    if (m_powerState == PowerState::Active && !IsOnScreen()) {
+        SetBrowserWindowHidden(true);
+    } else if (m_powerState == PowerState::Hidden && IsOnScreen()) {
+        MarkActivity();
+    }
+}
+
+void BrowserWidget::showEvent(QShowEvent* event) {
+    QWidget::showEvent(event);
+    if (m_powerState == PowerState::Discarded) {
+        if (!m_lastUrl.isEmpty()) {
+            RestorePage(m_lastUrl);
+        }
+    } else {
+        MarkActivity();
+    }
+}
+
+void BrowserWidget::hideEvent(QHideEvent* event) {
+    QWidget::hideEvent(event);
+    if (m_powerState == PowerState::Active) {
+        SetBrowserWindowHidden(true);
+    }
 }
 
 void BrowserWidget::closeEvent(QCloseEvent* event) {
@@ -335,3 +490,142 @@ void BrowserWidget::ResizeBrowser() {
     }
 #endif
 }
+
+// ===== 省电 =====
+
+void BrowserWidget::SetPowerPolicy(const QString& label, int idleHideSeconds, int discardMinutes) {
+    m_powerLabel = label;
+    m_idleHideSeconds = idleHideSeconds;
+    m_discardMinutes = discardMinutes;
+}
+
+bool BrowserWidget::IsOnScreen() const {
+    return isVisible() && width() > 0 && height() > 0;
+}
+
+void BrowserWidget::MarkActivity() {
+    m_idleClock.restart();
+    if (m_powerState == PowerState::Hidden && IsOnScreen()) {
+        SetBrowserWindowHidden(false);
+    }
+}
+
+void BrowserWidget::NoteUserInput() {
+    m_userInputClock.restart();
+    MarkActivity();
+}
+
+// 浏览器窗口隐藏时点到的是这个控件本身（空白区域），点击/滚动即恢复页面
+void BrowserWidget::mousePressEvent(QMouseEvent* event) {
+    NoteUserInput();
+    QWidget::mousePressEvent(event);
+}
+
+void BrowserWidget::wheelEvent(QWheelEvent* event) {
+    NoteUserInput();
+    QWidget::wheelEvent(event);
+}
+
+void BrowserWidget::SetBrowserWindowHidden(bool hidden) {
+    if (!m_handler || !m_handler->GetBrowser()) {
+        return;
+    }
+
+    // 窗口模式浏览器：隐藏浏览器子窗口后页面变为 hidden，
+    // Chromium 停止绘制和 requestAnimationFrame，定时器按后台页面节流
+#ifdef _WIN32
+    HWND browserHwnd = m_handler->GetBrowser()->GetHost()->GetWindowHandle();
+    if (browserHwnd) {
+        ShowWindow(browserHwnd, hidden ? SW_HIDE : SW_SHOW);
+    }
+#endif
+    if (!hidden) {
+        ResizeBrowser();
+    }
+
+    PowerState state = hidden ? PowerState::Hidden : PowerState::Active;
+    if (state != m_powerState) {
+        m_powerState = state;
+        xfDebug(lcCef) << "[POWER]" << m_powerLabel << (hidden ? "hidden" : "active")
+                       << Logger::kv("idleSecs", m_idleClock.elapsed() / 1000);
+    }
+}
+
+void BrowserWidget::RestorePage(const QString& url) {
+    xfInfo(lcCef) << "[POWER]" << m_powerLabel << "restore page" << url;
+    m_powerState = PowerState::Active;
+    m_idleClock.restart();
+    if (m_browserCreated) {
+        // 释放还没完成，关闭后再创建
+        m_pendingUrl = url;
+        m_recreatePending = true;
+        return;
+    }
+    CreateBrowserInternal(url);
+}
+
+bool BrowserWidget::RecyclePage() {
+    if (!m_handler || !m_handler->GetBrowser() || m_lastUrl.isEmpty()) {
+        return false;
+    }
+    // browserClosed 后按 m_pendingUrl 重建
+    m_pendingUrl = m_lastUrl;
+    m_recreatePending = true;
+    m_handler->GetBrowser()->GetHost()->CloseBrowser(true);
+    return true;
+}
+
+bool BrowserWidget::IsLoading() const {
+    return m_handler && m_handler->GetBrowser() && m_handler->GetBrowser()->IsLoading();
+}
+
+void BrowserWidget::OnPowerTick() {
+    if (!m_browserCreated || m_powerState == PowerState::Discarded) {
+        return;
+    }
+
+    qint64 idleSecs = m_idleClock.elapsed() / 1000;
+    bool idle = m_idleHideSeconds > 0 && idleSecs >= m_idleHideSeconds;
+    // 在屏幕上的浏览器只在主窗口不是活动窗口（用户没在看程序）时才按空闲隐藏，
+    // 切回程序后下一次检查即恢复显示
+    bool shouldHide = !IsOnScreen() || (idle && !isActiveWindow());
+    if (shouldHide != (m_powerState == PowerState::Hidden)) {
+        SetBrowserWindowHidden(shouldHide);
+    }
+
+    // 隐藏且长时间无操作：关闭浏览器释放渲染进程，保留最后的 URL
+    if (m_powerState == PowerState::Hidden && m_discardMinutes > 0 &&
+        idleSecs >= m_discardMinutes * 60 && m_handler && m_handler->GetBrowser()) {
+        SampleUsage();
+        xfInfo(lcCef) << "[POWER]" << m_powerLabel << "discard page after idle"
+                      << Logger::kv("idleMin", idleSecs / 60) << Logger::kv("url", m_lastUrl);
+        m_powerState = PowerState::Discarded;
+        m_recreatePending = false;
+        m_handler->GetBrowser()->GetHost()->CloseBrowser(true);
+    }
+}
+
+void BrowserWidget::SampleUsage() {
+    qint64 pid = rendererPid();
+    ProcessStats::Sample usage = ProcessStats::sample(pid);
+    double cpu = pid == m_lastUsagePid
+                     ? ProcessStats::cpuPercent(m_lastUsage, usage, m_usageClock.elapsed())
+                     : 0.0;
+    m_usageClock.restart();
+    m_lastUsage = usage;
+    m_lastUsagePid = pid;
+    if (!usage.valid) {
+        return;
+    }
+
+    // 同一站点的多个浏览器可能共用一个渲染进程，此时数字是进程合计
+    static const char* const kStateNames[] = {"active", "hidden", "discarded"};
+    xfInfo(lcCef).noquote()
+        << QString("[POWER] %1 state=%2 pid=%3 cpu=%4% workingSet=%5MB private=%6MB")
+               .arg(m_powerLabel.isEmpty() ? QString("browser") : m_powerLabel)
+               .arg(kStateNames[static_cast<int>(m_powerState)])
+               .arg(pid)
+               .arg(cpu, 0, 'f', 2)
+               .arg(usage.workingSetBytes / (1024 * 1024))
+               .arg(usage.privateBytes / (1024 * 1024));
+}
@@ -1,8 +1,11 @@
 #ifndef BROWSERWIDGET_H
 #define BROWSERWIDGET_H
 
+#include <QElapsedTimer>
+#include <QTimer>
 #include <QWidget>
 #include "App/CefHandler.h"
+#include "Utils/ProcessStats.h"
 #include "include/cef_browser.h"
 
 class BrowserWidget : public QWidget {
@@ -17,11 +20,41 @@ public:
     void CreateBrowserWithProfile(const QString& url, const QString& profilePath);
     void SwitchProfile(const QString& url, const QString& profilePath);
 
+    // 文档开始脚本（按角色注册），每次页面加载时在页面脚本之前执行
+    void SetStartupScript(const QString& role, const std::string& script);
+    void SetStartupPrelude(const std::string& prelude); // 脚本之前执行的数据，可单独更新
+
+    // 资源拦截策略（扫描类浏览器），需在创建浏览器之前调用
+    void SetResourcePolicy(const QString& label, const ResourcePolicy& policy);
+
+    // 省电策略：不可见或空闲的浏览器隐藏窗口（页面进入后台节流），
+    // 长时间空闲则释放页面，下次 LoadUrl/Reload/重新显示时按最后的 URL 恢复
+    enum class PowerState { Active, Hidden, Discarded };
+    // idleHideSeconds: 无操作多久后隐藏（0 = 只在不可见时隐藏）
+    // discardMinutes: 隐藏且无操作多久后释放页面（0 = 从不）
+    void SetPowerPolicy(const QString& label, int idleHideSeconds, int discardMinutes);
+    PowerState powerState() const { return m_powerState; }
+    // 有操作：恢复隐藏/释放的页面并重置空闲计时（页面在后台长时间工作时由调用方续期）
+    void MarkActivity();
+    // 用户在页面里的点击/滚动/按键（Windows 上从线程消息队列识别，也算作活动）
+    void NoteUserInput();
+    qint64 UserIdleSecs() const { return m_userInputClock.elapsed() / 1000; }
+
+    // 关闭并按当前 URL 重建浏览器（换一个新的渲染进程，回收内存）；
+    // 没有浏览器或还没有可恢复的 URL 时返回 false
+    bool RecyclePage();
+    bool IsLoading() const;
+
+    // 最近一次渲染进程采样（CPU/内存）
+    const ProcessStats::Sample& lastUsage() const { return m_lastUsage; }
+    qint64 rendererPid() const { return m_handler ? m_handler->RendererPid() : 0; }
+
     // Navigate to URL
     void LoadUrl(const QString& url);
 
     // Execute JavaScript
     void ExecuteJavaScript(const QString& code);
+    void ExecuteJavaScript(const std::string& code);
     void executeJavaScript(const QString& code) { ExecuteJavaScript(code); }
 
     // Get handler
@@ -58,7 +91,7 @@ signals:
     void networkLogReceived(const QString& log);
 
     // X互关宝专用信号转发
-    void newPostsFound(const QString& jsonData);
+    void newPostsFound(const QJsonArray& posts);
     void followSuccess(const QString& userHandle);
     void alreadyFollowing(const QString& userHandle);
     void followFailed(const QString& userHandle);
@@ -72,20 +105,35 @@ signals:
     void unfollowSuccess(const QString& userHandle);
     void unfollowFailed(const QString& userHandle);
     // 粉丝采集信号
-    void newFollowersFound(const QString& jsonData);
+    void newFollowersFound(const QJsonArray& followers);
     // 登录状态信号
     void userLoggedIn();
     // 回关探测信号
-    void followBackDetected(const QString& jsonData);
+    void followBackDetected(const QJsonArray& followers);
+    void followerSnapshotReceived(const QJsonArray& handles);
+    void followerSnapshotDone(bool complete, int count);
+    void apiResponseCaptured(const QString& operation, const QByteArray& body);
 
 protected:
     void resizeEvent(QResizeEvent* event) override;
     void closeEvent(QCloseEvent* event) override;
+    void showEvent(QShowEvent* event) override;
+    void hideEvent(QHideEvent* event) override;
+    void mousePressEvent(QMouseEvent* event) override;
+    void wheelEvent(QWheelEvent* event) override;
 
 private:
     void ResizeBrowser();
     void CreateBrowserInternal(const QString& url);
     void CloseBrowserForSwitch();
+    void ReleaseRequestContext();
+
+    // 省电
+    void RestorePage(const QString& url);
+    void SetBrowserWindowHidden(bool hidden);
+    void OnPowerTick();
+    void SampleUsage();
+    bool IsOnScreen() const;
 
     CefHandler* m_handler;
     bool m_browserCreated;
@@ -93,7 +141,25 @@ private:
     bool m_recreatePending;
     QString m_profilePath;
     QString m_pendingUrl;
-    CefRefPtr<CefRequestContext> m_requestContext;
+    CefRefPtr<CefRequestContext> m_requestContext; // 来自 RequestContextRegistry，按 profile 共享
+    QString m_contextProfilePath;                  // m_requestContext 对应的 profile
+
+    // 省电
+    QString m_powerLabel;
+    int m_idleHideSeconds = 0;
+    int m_discardMinutes = 0;
+    PowerState m_powerState = PowerState::Active;
+    QString m_lastUrl;           // 释放页面后按此恢复
+    QElapsedTimer m_idleClock;   // 距离上次操作/加载
+    QElapsedTimer m_userInputClock; // 距离用户上次输入
+    QTimer* m_powerTimer = nullptr;
+    QTimer* m_usageTimer = nullptr;
+    ProcessStats::Sample m_lastUsage;
+    QElapsedTimer m_usageClock;
+    qint64 m_lastUsagePid = 0;
+
+    static const int POWER_TICK_MS = 15 * 1000;          // 空闲检查间隔
+    static const int USAGE_REPORT_MS = 5 * 60 * 1000;    // CPU/内存统计间隔
 };
 
 #endif // BROWSERWIDGET_H
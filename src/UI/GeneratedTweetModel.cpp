@@ -0,0 +1,81 @@
+#include "GeneratedTweetModel.h"
+#include <QColor>
+
+GeneratedTweetModel::GeneratedTweetModel(QObject *parent)
+    : QAbstractListModel(parent) {}
+
+int GeneratedTweetModel::rowCount(const QModelIndex &parent) const {
+  return parent.isValid() ? 0 : m_tweets.size();
+}
+
+QVariant GeneratedTweetModel::data(const QModelIndex &index, int role) const {
+  const GeneratedTweet *tweet = tweetAt(index.row());
+  if (!index.isValid() || !tweet) {
+    return QVariant();
+  }
+
+  switch (role) {
+  case Qt::DisplayRole:
+    return QString("#%1 [%2]")
+        .arg(tweet->id)
+        .arg(GeneratedTweet::statusLabel(tweet->status));
+  case Qt::ForegroundRole:
+    // 根据状态设置颜色
+    if (tweet->status == GeneratedTweet::Status::Published) {
+      return QColor(0, 180, 0);
+    } else if (tweet->status == GeneratedTweet::Status::Skipped) {
+      return QColor(150, 150, 150);
+    }
+    return QColor(255, 165, 0);
+  case Qt::ToolTipRole:
+    return tweet->createdAt.toString("yyyy-MM-dd HH:mm:ss");
+  case TextRole:
+    return tweet->text;
+  case IdRole:
+    return tweet->id;
+  case StatusRole:
+    return static_cast<int>(tweet->status);
+  default:
+    return QVariant();
+  }
+}
+
+void GeneratedTweetModel::setTweets(const QList<GeneratedTweet> &tweets) {
+  beginResetModel();
+  m_tweets = tweets;
+  endResetModel();
+}
+
+const GeneratedTweet &GeneratedTweetModel::appendTweet(const QString &text) {
+  GeneratedTweet tweet;
+  tweet.id = m_tweets.isEmpty() ? 1 : m_tweets.last().id + 1;
+  tweet.text = text;
+  tweet.status = GeneratedTweet::Status::Pending;
+  tweet.createdAt = QDateTime::currentDateTime();
+
+  // 新帖子显示在顶部
+  beginInsertRows(QModelIndex(), 0, 0);
+  m_tweets.append(tweet);
+  endInsertRows();
+  return m_tweets.last();
+}
+
+bool GeneratedTweetModel::setStatus(int row, GeneratedTweet::Status status) {
+  int i = dataIndex(row);
+  if (i < 0 || i >= m_tweets.size() || m_tweets[i].status == status) {
+    return false;
+  }
+  m_tweets[i].status = status;
+  QModelIndex idx = index(row);
+  emit dataChanged(idx, idx,
+                   {Qt::DisplayRole, Qt::ForegroundRole, StatusRole});
+  return true;
+}
+
+const GeneratedTweet *GeneratedTweetModel::tweetAt(int row) const {
+  int i = dataIndex(row);
+  if (row < 0 || i < 0 || i >= m_tweets.size()) {
+    return nullptr;
+  }
+  return &m_tweets[i];
+}
@@ -0,0 +1,36 @@
+#ifndef GENERATEDTWEETMODEL_H
+#define GENERATEDTWEETMODEL_H
+
+#include <QAbstractListModel>
+#include <QList>
+#include "Data/GeneratedTweet.h"
+
+// 生成帖子列表模型
+// 显示顺序为倒序（最新的在第0行），状态变化只刷新对应的一行
+class GeneratedTweetModel : public QAbstractListModel {
+    Q_OBJECT
+
+public:
+    enum Roles {
+        TextRole = Qt::UserRole + 1, // 帖子全文
+        IdRole,                      // 帖子序号
+        StatusRole                   // 状态（GeneratedTweet::Status 转 int）
+    };
+
+    explicit GeneratedTweetModel(QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    void setTweets(const QList<GeneratedTweet>& tweets);
+    const GeneratedTweet& appendTweet(const QString& text); // 插入到第0行
+    bool setStatus(int row, GeneratedTweet::Status status);
+    const GeneratedTweet* tweetAt(int row) const;
+
+private:
+    int dataIndex(int row) const { return m_tweets.size() - 1 - row; }
+
+    QList<GeneratedTweet> m_tweets; // 按生成顺序存放
+};
+
+#endif // GENERATEDTWEETMODEL_H
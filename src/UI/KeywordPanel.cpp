@@ -49,11 +49,37 @@ QList<Keyword> KeywordPanel::getKeywords() const {
     return m_keywords;
 }
 
+void KeywordPanel::updateKeywordStats(const QList<Keyword>& keywords) {
+    for (const auto& src : keywords) {
+        for (int i = 0; i < m_keywords.size(); ++i) {
+            if (m_keywords[i].id != src.id) {
+                continue;
+            }
+            // 只同步统计字段，保留面板上的文本和启用状态
+            Keyword& kw = m_keywords[i];
+            kw.matchCount = src.matchCount;
+            kw.pageLoads = src.pageLoads;
+            kw.newAccounts = src.newAccounts;
+            kw.duplicateHits = src.duplicateHits;
+            kw.followedCount = src.followedCount;
+            kw.followBackCount = src.followBackCount;
+            kw.recentLoads = src.recentLoads;
+            kw.recentNewAccounts = src.recentNewAccounts;
+            if (i < m_listWidget->count()) {
+                applyItemStats(m_listWidget->item(i), kw);
+            }
+            break;
+        }
+    }
+}
+
 void KeywordPanel::updateList() {
     m_listWidget->clear();
     for (const auto& kw : m_keywords) {
-        QListWidgetItem* item = new QListWidgetItem(kw.text);
+        QListWidgetItem* item = new QListWidgetItem();
         item->setData(Qt::UserRole, kw.id);
+        item->setData(Qt::UserRole + 1, kw.text);
+        applyItemStats(item, kw);
         if (!kw.isEnabled) {
             item->setForeground(Qt::gray);
         }
@@ -61,6 +87,33 @@ void KeywordPanel::updateList() {
     }
 }
 
+void KeywordPanel::applyItemStats(QListWidgetItem* item, const Keyword& kw) {
+    if (kw.pageLoads == 0) {
+        item->setText(kw.text);
+        item->setToolTip(kw.matchCount > 0 ? QString("命中帖子: %1").arg(kw.matchCount)
+                                           : QString("尚未统计"));
+        return;
+    }
+
+    // 列表只显示摘要：每次加载新账号数 / 重复率 / 回关率
+    item->setText(QString("%1    新%2/次  重复%3%  回关%4%")
+                      .arg(kw.text)
+                      .arg(kw.yieldPerLoad(), 0, 'f', 1)
+                      .arg(qRound(kw.duplicateRate() * 100))
+                      .arg(qRound(kw.followBackRate() * 100)));
+    item->setToolTip(QString("搜索页加载: %1 次\n"
+                             "命中帖子: %2\n"
+                             "新账号: %3\n"
+                             "重复账号: %4\n"
+                             "已关注: %5，已回关: %6")
+                         .arg(kw.pageLoads)
+                         .arg(kw.matchCount)
+                         .arg(kw.newAccounts)
+                         .arg(kw.duplicateHits)
+                         .arg(kw.followedCount)
+                         .arg(kw.followBackCount));
+}
+
 void KeywordPanel::onAddClicked() {
     QString text = m_inputEdit->text().trimmed();
     if (text.isEmpty()) {
@@ -90,7 +143,7 @@ void KeywordPanel::onDeleteClicked() {
     }
 
     // 默认关键词"互关"不允许删除
-    QString keyword = item->text();
+    QString keyword = item->data(Qt::UserRole + 1).toString();
     if (keyword == "互关") {
         QMessageBox::warning(this, "提示", "默认关键词\"互关\"不能删除");
         return;
@@ -110,7 +163,7 @@ void KeywordPanel::onDeleteClicked() {
 
 void KeywordPanel::onItemDoubleClicked(QListWidgetItem* item) {
     // 双击关键词：跳转到该关键词的Latest搜索页面
-    QString keyword = item->text();
+    QString keyword = item->data(Qt::UserRole + 1).toString();
     if (!keyword.isEmpty()) {
         emit keywordDoubleClicked(keyword);
     }
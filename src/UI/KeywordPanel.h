@@ -16,6 +16,8 @@ public:
 
     void setKeywords(const QList<Keyword>& keywords);
     QList<Keyword> getKeywords() const;
+    // 只刷新产出统计（按id匹配，不重建列表、不影响选中项）
+    void updateKeywordStats(const QList<Keyword>& keywords);
 
 signals:
     void keywordsChanged();
@@ -28,6 +30,7 @@ private slots:
 
 private:
     void updateList();
+    void applyItemStats(QListWidgetItem* item, const Keyword& kw);
 
     QLineEdit* m_inputEdit;
     QPushButton* m_addBtn;
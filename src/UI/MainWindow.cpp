@@ -2,21 +2,31 @@
 #include "App/CefApp.h"
 #include "BrowserWidget.h"
 #include "Core/AutoFollower.h"
+#include "Core/CaptureCoverage.h"
 #include "Core/DingTalkNotifier.h"
+#include "Core/FollowBackReconciler.h"
+#include "Core/FollowerSourceScheduler.h"
+#include "Core/KeywordScheduler.h"
 #include "Core/PostMonitor.h"
+#include "Core/QueryPlanner.h"
+#include "Core/RendererWatchdog.h"
+#include "Core/TimelineParser.h"
 #include "Data/DataStorage.h"
+#include "GeneratedTweetModel.h"
 #include "KeywordPanel.h"
 #include "PostListPanel.h"
+#include "Utils/Logger.h"
 #include <QApplication>
 #include <QClipboard>
 #include <QCloseEvent>
 #include <QDebug>
 #include <QDesktopServices>
+#include <QElapsedTimer>
 #include <QGroupBox>
 #include <QHBoxLayout>
+#include <QHash>
 #include <QHeaderView>
 #include <QJsonArray>
-#include <QJsonDocument>
 #include <QJsonObject>
 #include <QMenu>
 #include <QMessageBox>
@@ -45,13 +55,15 @@ MainWindow::MainWindow(QWidget *parent)
       m_unfollowDaysSpinBox(nullptr), m_rightPanel(nullptr),
       m_cooldownLabel(nullptr), m_userBrowser(nullptr), m_logTextEdit(nullptr),
       m_statusLabel(nullptr), m_dataStorage(nullptr), m_postMonitor(nullptr),
-      m_autoFollower(nullptr), m_cefTimerId(0),
+      m_autoFollower(nullptr), m_keywordScheduler(nullptr),
+      m_queryPlanner(nullptr),
       m_searchBrowserInitialized(false), m_userBrowserInitialized(false),
       m_cooldownTimer(nullptr), m_cooldownMinSeconds(60),
       m_cooldownMaxSeconds(180), m_remainingCooldown(0),
       m_isCooldownActive(false), m_isAutoFollowing(false),
-      m_autoRefreshTimer(nullptr), m_currentKeywordIndex(0),
-      m_followersSwitchTimer(nullptr), m_currentFollowedUserIndex(-1),
+      m_autoRefreshTimer(nullptr),
+      m_followersSwitchTimer(nullptr), m_followerSourceScheduler(nullptr),
+      m_rendererWatchdog(nullptr), m_followBackReconciler(nullptr),
       m_isCheckingFollowBack(false), m_followBackCheckCount(0),
       m_consecutiveFailures(0), m_isSleeping(false), m_remainingSleepSeconds(0),
       m_sleepTimer(nullptr), m_followedCurrentPage(0), m_followedPageSize(100),
@@ -61,7 +73,8 @@ MainWindow::MainWindow(QWidget *parent)
       m_followBackDetectBrowser(nullptr),
       m_followBackDetectBrowserInitialized(false),
       m_followBackDetectTimer(nullptr), m_tweetGenPanel(nullptr),
-      m_generatedTweetsList(nullptr), m_tweetPreviewEdit(nullptr) {
+      m_generatedTweetsList(nullptr), m_generatedTweetModel(nullptr),
+      m_tweetPreviewEdit(nullptr) {
 
   setWindowTitle("X互关宝 - X.com互关粉丝助手");
   resize(2400, 900);
@@ -75,6 +88,13 @@ MainWindow::MainWindow(QWidget *parent)
   connect(m_autoRefreshTimer, &QTimer::timeout, this,
           &MainWindow::onAutoRefreshTimeout);
 
+  // 关键词统计（已关注数/回关数）变化后延迟保存，崩溃或重启不丢计数
+  m_keywordSaveTimer = new QTimer(this);
+  m_keywordSaveTimer->setSingleShot(true);
+  m_keywordSaveTimer->setInterval(KEYWORD_SAVE_DELAY_MS);
+  connect(m_keywordSaveTimer, &QTimer::timeout, this,
+          [this]() { m_dataStorage->saveKeywords(m_keywords); });
+
   // 初始化休眠计时器
   m_sleepTimer = new QTimer(this);
   connect(m_sleepTimer, &QTimer::timeout, this, &MainWindow::onSleepTick);
@@ -112,30 +132,52 @@ MainWindow::MainWindow(QWidget *parent)
   // 添加固定的作者帖子（永久显示，不会隐藏或删除）
   addPinnedAuthorPost();
 
+  // 建立全文检索索引
+  m_searchIndex.build(m_posts);
+
   // 初始化帖子监控器
   m_postMonitor = new PostMonitor(this);
 
   // 初始化自动关注器
   m_autoFollower = new AutoFollower(this);
 
+  // 初始化关键词调度器和搜索查询规划器
+  m_keywordScheduler = new KeywordScheduler(this);
+  m_queryPlanner = new QueryPlanner(this);
+  m_config = m_dataStorage->loadConfig();
+  m_maxSearchQueryLength =
+      m_config.value("maxSearchQueryLength")
+          .toInt(QueryPlanner::DEFAULT_MAX_QUERY_LENGTH);
+  // 按分类调整日志级别（config.json 的 logLevels）
+  Logger::applyLevels(m_config.value("logLevels").toObject());
+  m_blockScannerResources =
+      m_config.value("blockScannerResources").toBool(true);
+  m_captureResponses = m_config.value("captureResponses").toBool(false);
+  // 回关对账：定期完整扫描 followBackAccount 的蓝V粉丝列表，得到粉丝快照
+  m_followBackAccount =
+      m_config.value("followBackAccount").toString("4111y80y");
+  m_followBackReconciler = new FollowBackReconciler(this);
+  m_followBackReconciler->setRefreshMinutes(
+      m_config.value("followBackSnapshotMinutes")
+          .toInt(FollowBackReconciler::DEFAULT_REFRESH_MINUTES));
+  m_followBackReconciler->loadState(m_dataStorage->loadFollowerSnapshot());
+
+  // 初始化粉丝采集来源调度器：加载来源记录，用互关用户建立轮换环
+  m_followerSourceScheduler = new FollowerSourceScheduler(this);
+  m_followerSourceScheduler->loadState(m_dataStorage->loadFollowerSources());
+  QStringList followedHandles;
+  for (const auto &post : m_posts) {
+    if (post.isFollowed && post.authorHandle != "4111y80y") {
+      followedHandles.append(post.authorHandle);
+    }
+  }
+  m_followerSourceScheduler->setSources(followedHandles);
+
   // 加载回关追踪数据
   m_usedFollowBackHandles = m_dataStorage->loadUsedFollowBackHandles();
-  m_generatedTweets = m_dataStorage->loadGeneratedTweets();
-  // 迁移旧格式：将纯字符串转为 {text, status} 对象
-  bool needsMigration = false;
-  for (int i = 0; i < m_generatedTweets.size(); ++i) {
-    if (m_generatedTweets[i].isString()) {
-      QJsonObject obj;
-      obj["text"] = m_generatedTweets[i].toString();
-      obj["status"] = QString::fromUtf8("\xe6\x9c\xaa\xe5\xa4\x84\xe7\x90\x86");
-      obj["createdAt"] = QString();
-      m_generatedTweets[i] = obj;
-      needsMigration = true;
-    }
-  }
-  if (needsMigration) {
-    m_dataStorage->saveGeneratedTweets(m_generatedTweets);
-  }
+  // 生成的帖子：加载快照并重放状态日志（旧格式在加载时自动迁移）
+  m_generatedTweetModel = new GeneratedTweetModel(this);
+  m_generatedTweetModel->setTweets(m_dataStorage->loadGeneratedTweets());
   m_tweetTemplates = m_dataStorage->loadTweetTemplates();
   // 加载未生成帖子的累计用户
   QJsonArray pendingUsers = m_dataStorage->loadPendingFollowBackUsers();
@@ -154,19 +196,38 @@ MainWindow::MainWindow(QWidget *parent)
   setupConnections();
   loadSettings();
 
-  // 启动时刷新帖子列表（从持久化数据）
-  refreshTweetList();
-
-  // Start CEF message loop timer
-  m_cefTimerId = startTimer(10);
+  // 渲染进程内存看门狗：超预算的浏览器在没有进行中的操作时重建
+  m_rendererWatchdog = new RendererWatchdog(this);
+  m_rendererWatchdog->setBudgetMB(
+      m_config.value("rendererMemoryBudgetMB").toInt(800));
+  auto watchBrowser = [this](const QString &label, BrowserWidget *browser,
+                             std::function<bool()> isSafePoint) {
+    m_rendererWatchdog->watch(
+        label, [browser]() { return browser->rendererPid(); },
+        [browser, isSafePoint]() {
+          return !browser->IsLoading() && (!isSafePoint || isSafePoint());
+        },
+        [this, label, browser]() {
+          if (!browser->RecyclePage()) {
+            return false;
+          }
+          appendLog(QString("%1 浏览器内存超出预算，重建页面释放内存").arg(label));
+          return true;
+        });
+  };
+  watchBrowser("search", m_searchBrowser, nullptr);
+  watchBrowser("followers", m_followersBrowser, nullptr);
+  watchBrowser("followback", m_followBackDetectBrowser,
+               [this]() { return !m_followBackReconciler->isScanning(); });
+  // 用户浏览器：用户可能正在输入或登录，要求一段时间没有输入才重建
+  watchBrowser("user", m_userBrowser, [this]() {
+    return !m_isAutoFollowing && !m_isCheckingFollowBack &&
+           m_userBrowser->UserIdleSecs() >= USER_IDLE_RECYCLE_SECS;
+  });
+  m_rendererWatchdog->start();
 }
 
-MainWindow::~MainWindow() {
-  saveSettings();
-  if (m_cefTimerId) {
-    killTimer(m_cefTimerId);
-  }
-}
+MainWindow::~MainWindow() { saveSettings(); }
 
 void MainWindow::setupUI() {
   // Main splitter - 三栏布局
@@ -234,6 +295,7 @@ void MainWindow::setupUI() {
   postLayout->setContentsMargins(0, 0, 0, 0);
 
   m_postListPanel = new PostListPanel(postTab);
+  m_postListPanel->setSearchIndex(&m_searchIndex);
   m_postListPanel->setPosts(m_posts);
   postLayout->addWidget(m_postListPanel);
 
@@ -491,6 +553,30 @@ void MainWindow::setupUI() {
   m_followBackDetectBrowser = new BrowserWidget(m_mainSplitter);
   m_followBackDetectBrowser->setMinimumWidth(350);
 
+  // 扫描类浏览器只读 DOM 文本，不加载图片/视频/字体/上报请求；
+  // 开启 captureResponses 时同时抓取时间线接口响应（DOM 提取照常运行作为兜底）
+  ResourcePolicy scannerPolicy = m_blockScannerResources
+                                     ? ResourcePolicy::scanner()
+                                     : ResourcePolicy::allowAll();
+  scannerPolicy.captureApi = m_captureResponses;
+  if (scannerPolicy.blocksAnything() || scannerPolicy.captureApi) {
+    m_searchBrowser->SetResourcePolicy("search", scannerPolicy);
+    m_followersBrowser->SetResourcePolicy("followers", scannerPolicy);
+    m_followBackDetectBrowser->SetResourcePolicy("followback", scannerPolicy);
+  }
+
+  // 省电：不可见/空闲的浏览器隐藏窗口，长时间空闲释放页面（config.json 可调）
+  int idleHideSeconds = m_config.value("browserIdleHideSeconds").toInt(120);
+  int hibernateMinutes = m_config.value("browserHibernateMinutes").toInt(10);
+  m_searchBrowser->SetPowerPolicy("search", idleHideSeconds, hibernateMinutes);
+  m_followersBrowser->SetPowerPolicy("followers", idleHideSeconds,
+                                     hibernateMinutes);
+  m_followBackDetectBrowser->SetPowerPolicy("followback", idleHideSeconds,
+                                            hibernateMinutes);
+  m_userBrowser->SetPowerPolicy("user", 0, 0); // 只在不可见时隐藏
+
+  registerStartupScripts();
+
   // 第5列 - 生成帖子面板
   m_tweetGenPanel = new QWidget(m_mainSplitter);
   QVBoxLayout *tweetGenLayout = new QVBoxLayout(m_tweetGenPanel);
@@ -507,15 +593,18 @@ void MainWindow::setupUI() {
                                "}");
   tweetGenLayout->addWidget(tweetGenTitle);
 
-  m_generatedTweetsList = new QListWidget(m_tweetGenPanel);
+  m_generatedTweetsList = new QListView(m_tweetGenPanel);
+  m_generatedTweetsList->setModel(m_generatedTweetModel);
+  m_generatedTweetsList->setUniformItemSizes(true);
+  m_generatedTweetsList->setEditTriggers(QAbstractItemView::NoEditTriggers);
   m_generatedTweetsList->setStyleSheet(
-      "QListWidget {"
+      "QListView {"
       "  background-color: #f8f9fa;"
       "  border: 1px solid #ddd;"
       "  font-size: 12px;"
       "}"
-      "QListWidget::item { padding: 5px; }"
-      "QListWidget::item:selected { background-color: #1da1f2; color: white; "
+      "QListView::item { padding: 5px; }"
+      "QListView::item:selected { background-color: #1da1f2; color: white; "
       "}");
   tweetGenLayout->addWidget(m_generatedTweetsList, 1);
 
@@ -673,12 +762,61 @@ void MainWindow::setupConnections() {
           &MainWindow::onFollowBackDetectLoadFinished);
   connect(m_followBackDetectBrowser, &BrowserWidget::followBackDetected, this,
           &MainWindow::onNewFollowBackDetected);
+  connect(m_followBackDetectBrowser, &BrowserWidget::followerSnapshotReceived,
+          this, &MainWindow::onFollowerSnapshotReceived);
+  connect(m_followBackDetectBrowser, &BrowserWidget::followerSnapshotDone, this,
+          &MainWindow::onFollowerSnapshotDone);
+  connect(m_followBackReconciler, &FollowBackReconciler::followersGained, this,
+          &MainWindow::onFollowersGained);
+  connect(m_followBackReconciler, &FollowBackReconciler::followersLost, this,
+          &MainWindow::onFollowersLost);
+
+  // 接口抓取（opt-in）：解析结果和 DOM 结果走同一套处理，重复的由去重逻辑忽略；
+  // DOM 上报的条目同时记入对照统计
+  if (m_captureResponses) {
+    const QList<QPair<QString, BrowserWidget *>> scanners = {
+        {"search", m_searchBrowser},
+        {"followers", m_followersBrowser},
+        {"followback", m_followBackDetectBrowser}};
+    for (const auto &scanner : scanners) {
+      QString role = scanner.first;
+      m_captureCoverage.insert(role, CaptureCoverage(role));
+      connect(scanner.second, &BrowserWidget::apiResponseCaptured, this,
+              [this, role](const QString &operation, const QByteArray &body) {
+                onApiResponseCaptured(role, operation, body);
+              });
+    }
+    auto noteDom = [this](const QString &role, const QJsonArray &arr,
+                          const char *idKey) {
+      QStringList ids;
+      for (const auto &v : arr) {
+        QString id = v.toObject().value(QLatin1String(idKey)).toString();
+        if (!id.isEmpty() && !id.contains("_mention_")) {
+          ids.append(id);
+        }
+      }
+      m_captureCoverage[role].noteDom(ids, QDateTime::currentMSecsSinceEpoch());
+    };
+    connect(m_searchBrowser, &BrowserWidget::newPostsFound, this,
+            [noteDom](const QJsonArray &arr) {
+              noteDom("search", arr, "postId");
+            });
+    connect(m_followersBrowser, &BrowserWidget::newFollowersFound, this,
+            [noteDom](const QJsonArray &arr) {
+              noteDom("followers", arr, "authorHandle");
+            });
+    connect(m_followBackDetectBrowser, &BrowserWidget::followBackDetected, this,
+            [noteDom](const QJsonArray &arr) {
+              noteDom("followback", arr, "handle");
+            });
+  }
 
   // 生成帖子列表交互
-  connect(m_generatedTweetsList, &QListWidget::currentRowChanged, this,
+  connect(m_generatedTweetsList->selectionModel(),
+          &QItemSelectionModel::currentChanged, this,
           &MainWindow::onGeneratedTweetClicked);
   m_generatedTweetsList->setContextMenuPolicy(Qt::CustomContextMenu);
-  connect(m_generatedTweetsList, &QListWidget::customContextMenuRequested, this,
+  connect(m_generatedTweetsList, &QListView::customContextMenuRequested, this,
           &MainWindow::onTweetListContextMenu);
 
   // 刷新间隔调整 - 立即生效并重启倒计时，同时保存设置
@@ -727,8 +865,8 @@ void MainWindow::loadSettings() {
     if (hasZeroWidth || sizes.size() != currentCount) {
       // 旧布局不兼容，使用默认5列布局
       m_mainSplitter->setSizes({450, 300, 450, 350, 250});
-      qDebug() << "[INFO] Splitter layout reset to 5-column default (old "
-                  "layout incompatible)";
+      xfInfo(lcUi) << "Splitter layout reset to 5-column default (old "
+                      "layout incompatible)";
     }
   }
 
@@ -787,6 +925,12 @@ void MainWindow::closeEvent(QCloseEvent *event) {
   // 保存数据（先更新缓存，再立即落盘）
   m_dataStorage->savePosts(m_posts);
   m_dataStorage->saveKeywords(m_keywords);
+  m_followerSourceScheduler->finishVisit(QDateTime::currentDateTime());
+  m_dataStorage->saveFollowerSources(m_followerSourceScheduler->saveState());
+  m_dataStorage->saveFollowerSnapshot(m_followBackReconciler->saveState());
+  for (auto &coverage : m_captureCoverage) {
+    coverage.report(QDateTime::currentMSecsSinceEpoch());
+  }
   m_dataStorage->flushPosts(); // 确保最终数据立即写入磁盘
 
   if (m_searchBrowser) {
@@ -802,13 +946,6 @@ void MainWindow::closeEvent(QCloseEvent *event) {
   QMainWindow::closeEvent(event);
 }
 
-void MainWindow::timerEvent(QTimerEvent *event) {
-  if (event->timerId() == m_cefTimerId) {
-    CefHelper::DoMessageLoopWork();
-  }
-  QMainWindow::timerEvent(event);
-}
-
 void MainWindow::showEvent(QShowEvent *event) {
   QMainWindow::showEvent(event);
 
@@ -816,41 +953,48 @@ void MainWindow::showEvent(QShowEvent *event) {
   if (!m_searchBrowserInitialized && m_searchBrowser) {
     m_searchBrowserInitialized = true;
     QString profilePath = m_dataStorage->getScannerProfilePath();
-    qDebug() << "[INFO] Creating search browser with scanner profile:"
-             << profilePath;
-    m_searchBrowser->CreateBrowserWithProfile(
-        "https://x.com/"
-        "search?q=%E4%BA%92%E5%85%B3%20filter%3Ablue_verified&f=live",
-        profilePath);
+    xfInfo(lcUi) << "Creating search browser with scanner profile:"
+                 << profilePath;
+    // scannerStartUrl 用于调试（例如 tools/resource_fixture_server.py 的测试页）
+    QString startUrl = m_config.value("scannerStartUrl").toString();
+    if (startUrl.isEmpty()) {
+      startUrl = "https://x.com/"
+                 "search?q=%E4%BA%92%E5%85%B3%20filter%3Ablue_verified&f=live";
+    }
+    m_searchBrowser->CreateBrowserWithProfile(startUrl, profilePath);
+    // 首个搜索页固定为默认关键词"互关"
+    int defaultIndex = keywordIndexOf("互关");
+    if (defaultIndex >= 0) {
+      recordSearchPageLoad({defaultIndex});
+    }
   }
 
   // 粉丝浏览器延迟创建，在搜索页面加载完成后创建，避免同时初始化同一配置目录
 }
 
 void MainWindow::onSearchBrowserCreated() {
-  qDebug() << "[INFO] Search browser created";
+  xfInfo(lcUi) << "Search browser created";
   m_statusLabel->setText("状态: 搜索浏览器就绪，请登录X.com");
 }
 
 void MainWindow::onUserBrowserCreated() {
-  qDebug() << "[INFO] User browser created";
+  xfInfo(lcUi) << "User browser created";
 }
 
 void MainWindow::onSearchLoadFinished(bool success) {
   if (success) {
-    qDebug() << "[INFO] Search page loaded";
+    xfDebug(lcMonitor) << "Search page loaded";
     m_statusLabel->setText("状态: 搜索页面加载完成，开始监控帖子...");
 
-    // 注入监控脚本
-    injectMonitorScript();
+    // 监控脚本已在文档开始时由渲染进程执行（registerStartupScripts）
 
     // 启动自动刷新定时器（60-180秒随机）
     int minSeconds = m_cooldownMinSpinBox->value();
     int maxSeconds = m_cooldownMaxSpinBox->value();
     int refreshInterval = minSeconds + (rand() % (maxSeconds - minSeconds + 1));
     m_autoRefreshTimer->start(refreshInterval * 1000);
-    qDebug() << "[INFO] Auto-refresh timer started, next refresh in"
-             << refreshInterval << "seconds";
+    xfDebug(lcMonitor) << "Auto-refresh timer started, next refresh in"
+                       << refreshInterval << "seconds";
 
     // 粉丝浏览器在用户登录后才创建（通过 onUserLoggedIn）
   } else {
@@ -879,29 +1023,27 @@ void MainWindow::onUserLoadFinished(bool success) {
 
   // 回关检查模式
   if (m_isCheckingFollowBack && !m_currentCheckingHandle.isEmpty()) {
-    qDebug()
-        << "[INFO] User page loaded, executing check follow-back script for:"
+    xfInfo(lcFollow)
+        << "User page loaded, executing check follow-back script for:"
         << m_currentCheckingHandle;
-    QString script = m_autoFollower->getCheckFollowBackScript();
-    m_userBrowser->ExecuteJavaScript(script);
+    m_userBrowser->ExecuteJavaScript(m_autoFollower->getCheckFollowBackScript());
     return;
   }
 
   // 关注模式
   if (!m_currentFollowingHandle.isEmpty()) {
-    qDebug() << "[INFO] User page loaded, executing follow script for:"
-             << m_currentFollowingHandle;
+    xfInfo(lcFollow) << "User page loaded, executing follow script for:"
+                     << m_currentFollowingHandle;
     m_statusLabel->setText(
         QString("状态: 正在关注 @%1...").arg(m_currentFollowingHandle));
 
     // 执行自动关注脚本
-    QString script = m_autoFollower->getFollowScript();
-    m_userBrowser->ExecuteJavaScript(script);
+    m_userBrowser->ExecuteJavaScript(m_autoFollower->getFollowScript());
   }
 }
 
 void MainWindow::onPostClicked(const Post &post) {
-  qDebug() << "[INFO] Post clicked:" << post.authorHandle;
+  xfInfo(lcUi) << "Post clicked:" << post.authorHandle;
 
   // 检查是否在冷却中
   if (m_isCooldownActive) {
@@ -926,7 +1068,7 @@ void MainWindow::onPostClicked(const Post &post) {
     m_userBrowser->setVisible(true);
     QString profilePath = m_dataStorage->getProfilePath();
     QString userUrl = QString("https://x.com/%1").arg(post.authorHandle);
-    qDebug() << "[INFO] Creating user browser with profile:" << profilePath;
+    xfInfo(lcUi) << "Creating user browser with profile:" << profilePath;
     m_userBrowser->CreateBrowserWithProfile(userUrl, profilePath);
   } else {
     // 浏览器已初始化，直接加载URL
@@ -935,17 +1077,25 @@ void MainWindow::onPostClicked(const Post &post) {
   }
 }
 
-void MainWindow::onNewPostsFound(const QString &jsonData) {
-  QJsonDocument doc = QJsonDocument::fromJson(jsonData.toUtf8());
-  if (!doc.isArray()) {
-    return;
-  }
-
+void MainWindow::onNewPostsFound(const QJsonArray &arr) {
   // 固定作者的handle
   const QString pinnedAuthorHandle = "4111y80y";
 
-  QJsonArray arr = doc.array();
   int newCount = 0;
+  // 关键词产出统计：关键词下标 -> (新账号数, 重复账号数)
+  QHash<int, QPair<int, int>> keywordYield;
+  bool matchCountChanged = false;
+
+  // 页面脚本按批上报，整批作为一个事务处理：去重索引只建一次，
+  // 新增/激活的帖子最后一次性写入存储，排序和界面刷新也只做一次
+  QSet<QString> knownPostIds;
+  QHash<QString, int> authorIndex;
+  for (int i = 0; i < m_posts.size(); ++i) {
+    knownPostIds.insert(m_posts[i].postId);
+    authorIndex.insert(m_posts[i].authorHandle, i);
+  }
+  QList<Post> addedPosts;
+  QSet<int> activatedIndexes;
 
   for (const auto &v : arr) {
     QJsonObject obj = v.toObject();
@@ -971,31 +1121,77 @@ void MainWindow::onNewPostsFound(const QString &jsonData) {
     if (post.authorHandle.isEmpty() || post.postId.isEmpty()) {
       continue;
     }
+    // 开启接口抓取时同一帖子会从抓取和 DOM 各来一次；已在库的 postId 下面会跳过，
+    // 但作者已在列表里的帖子不入库，这里按本次运行处理过的 ID 跳过，避免重复计数
+    if (!markPostHandled(post.postId)) {
+      continue;
+    }
+    int yieldKeyword = attributeKeyword(obj);
 
-    // 去重：按作者去重（同一作者只保留一条帖子，因为目的是关注用户）
-    bool exists = false;
-    for (int i = 0; i < m_posts.size(); ++i) {
-      // 按postId去重，或者按作者去重
-      if (m_posts[i].postId == post.postId ||
-          m_posts[i].authorHandle == post.authorHandle) {
-        exists = true;
-        // 如果是未关注的用户再次出现，更新采集时间使其前置（激活）
-        if (!m_posts[i].isFollowed) {
-          m_posts[i].collectTime = QDateTime::currentDateTime();
-          m_dataStorage->updatePost(m_posts[i]);
-          newCount++; // 标记有变化，需要重新排序
+    // 页面脚本的已处理ID缓存是有界的，淘汰后同一帖子会再次上报，
+    // 以这里的帖子列表为准：同一 postId 直接忽略，不计产出也不激活
+    if (knownPostIds.contains(post.postId)) {
+      continue;
+    }
+
+    // 命中次数：只按原帖计数（被@记录沿用原帖的关键词，不重复计）
+    if (!post.postId.contains("_mention_")) {
+      for (const auto &v : obj["matchedKeywords"].toArray()) {
+        int index = keywordIndexOf(v.toString());
+        if (index >= 0) {
+          m_keywords[index].matchCount++;
+          matchCountChanged = true;
         }
-        break;
       }
     }
 
-    if (!exists) {
+    // 去重：按作者去重（同一作者只保留一条帖子，因为目的是关注用户）
+    int existing = authorIndex.value(post.authorHandle, -1);
+    if (existing >= 0) {
+      if (yieldKeyword >= 0) {
+        keywordYield[yieldKeyword].second++;
+      }
+      // 如果是未关注的用户再次出现，更新采集时间使其前置（激活）
+      if (!m_posts[existing].isFollowed) {
+        m_posts[existing].collectTime = QDateTime::currentDateTime();
+        activatedIndexes.insert(existing);
+        newCount++; // 标记有变化，需要重新排序
+      }
+    } else {
+      authorIndex.insert(post.authorHandle, m_posts.size());
+      knownPostIds.insert(post.postId);
       m_posts.append(post);
-      m_dataStorage->addPost(post);
+      m_searchIndex.addOrUpdate(post);
+      addedPosts.append(post);
       newCount++;
+      if (yieldKeyword >= 0) {
+        keywordYield[yieldKeyword].first++;
+      }
     }
   }
 
+  // 一次写入存储（内部只调度一次延迟保存）
+  if (!addedPosts.isEmpty()) {
+    m_dataStorage->addPosts(addedPosts);
+  }
+  if (!activatedIndexes.isEmpty()) {
+    QList<Post> activated;
+    for (int index : activatedIndexes) {
+      activated.append(m_posts[index]);
+    }
+    m_dataStorage->updatePosts(activated);
+  }
+
+  // 产出计入实际命中的关键词
+  for (auto it = keywordYield.constBegin(); it != keywordYield.constEnd();
+       ++it) {
+    m_keywordScheduler->recordResults(m_keywords[it.key()], it.value().first,
+                                      it.value().second);
+  }
+  if (!keywordYield.isEmpty() || matchCountChanged) {
+    m_keywordPanel->updateKeywordStats(m_keywords);
+  }
+
   if (newCount > 0) {
     // 排序优先级：1.固定帖子 2.关键词搜索账号 3.粉丝采集账号，同级按采集时间降序
     std::sort(m_posts.begin(), m_posts.end(),
@@ -1020,12 +1216,32 @@ void MainWindow::onNewPostsFound(const QString &jsonData) {
     m_postListPanel->setPosts(m_posts);
     updateStatusBar();
     updateFollowersBrowserState(); // 更新粉丝面板数量显示
-    qDebug() << "[INFO] Found" << newCount << "new posts";
+    xfDebug(lcMonitor) << "New posts" << Logger::kv("batch", arr.size())
+                       << Logger::kv("added", addedPosts.size())
+                       << Logger::kv("activated", activatedIndexes.size())
+                       << Logger::kv("total", m_posts.size());
   }
 }
 
+bool MainWindow::markPostHandled(const QString &postId) {
+  if (m_handledPostIds.contains(postId)) {
+    return false;
+  }
+  if (m_handledPostIdsPrevious.remove(postId)) {
+    m_handledPostIds.insert(postId);
+    return false;
+  }
+  m_handledPostIds.insert(postId);
+  // 当前代写满一半容量时降为上一代，原上一代丢弃（同 id_cache.js）
+  if (m_handledPostIds.size() >= HANDLED_POST_IDS_CAPACITY / 2) {
+    m_handledPostIdsPrevious.swap(m_handledPostIds);
+    m_handledPostIds.clear();
+  }
+  return true;
+}
+
 void MainWindow::onFollowSuccess(const QString &userHandle) {
-  qDebug() << "[SUCCESS] Followed:" << userHandle;
+  xfInfo(lcFollow) << "Followed:" << userHandle;
 
   // 记录日志
   appendLog(QString("关注 @%1 成功").arg(m_currentFollowingHandle));
@@ -1038,6 +1254,19 @@ void MainWindow::onFollowSuccess(const QString &userHandle) {
       m_dataStorage->updatePost(m_posts[i]);
     }
   }
+  m_followerSourceScheduler->addSource(m_currentFollowingHandle);
+
+  // 关键词产出统计：已关注数
+  for (const auto &post : m_posts) {
+    if (post.authorHandle == m_currentFollowingHandle) {
+      if (Keyword *kw = keywordForPost(post)) {
+        kw->followedCount++;
+        m_keywordPanel->updateKeywordStats(m_keywords);
+        m_keywordSaveTimer->start();
+      }
+      break;
+    }
+  }
 
   m_postListPanel->setPosts(m_posts);
   updateFollowedAuthorsTable();
@@ -1055,7 +1284,7 @@ void MainWindow::onFollowSuccess(const QString &userHandle) {
 }
 
 void MainWindow::onAlreadyFollowing(const QString &userHandle) {
-  qDebug() << "[INFO] Already following:" << userHandle;
+  xfInfo(lcFollow) << "Already following:" << userHandle;
 
   // 记录日志
   appendLog(QString("@%1 已关注，跳过").arg(m_currentFollowingHandle));
@@ -1067,6 +1296,7 @@ void MainWindow::onAlreadyFollowing(const QString &userHandle) {
       m_dataStorage->updatePost(m_posts[i]);
     }
   }
+  m_followerSourceScheduler->addSource(m_currentFollowingHandle);
 
   m_postListPanel->setPosts(m_posts);
   updateFollowedAuthorsTable();
@@ -1084,7 +1314,7 @@ void MainWindow::onAlreadyFollowing(const QString &userHandle) {
 }
 
 void MainWindow::onFollowFailed(const QString &userHandle) {
-  qDebug() << "[ERROR] Follow failed:" << userHandle;
+  xfWarning(lcFollow) << "Follow failed:" << userHandle;
 
   // 增加连续失败计数
   m_consecutiveFailures++;
@@ -1111,7 +1341,7 @@ void MainWindow::onFollowFailed(const QString &userHandle) {
 }
 
 void MainWindow::onAccountSuspended(const QString &userHandle) {
-  qDebug() << "[WARNING] Account suspended:" << userHandle;
+  xfWarning(lcFollow) << "Account suspended:" << userHandle;
 
   // 记录日志
   appendLog(QString("@%1 账号被封禁，已删除").arg(userHandle));
@@ -1121,9 +1351,11 @@ void MainWindow::onAccountSuspended(const QString &userHandle) {
   // 从帖子列表中删除该用户的所有帖子
   for (int i = m_posts.size() - 1; i >= 0; --i) {
     if (m_posts[i].authorHandle == userHandle) {
+      m_searchIndex.remove(m_posts[i].postId);
       m_posts.removeAt(i);
     }
   }
+  m_followerSourceScheduler->removeSource(userHandle);
 
   // 保存并更新界面
   m_dataStorage->savePosts(m_posts);
@@ -1147,7 +1379,7 @@ void MainWindow::onKeywordsChanged() {
   m_keywords = m_keywordPanel->getKeywords();
   m_dataStorage->saveKeywords(m_keywords);
 
-  // 重新注入监控脚本
+  // 更新文档开始脚本，并把关键词热更新到当前页面
   injectMonitorScript();
 }
 
@@ -1172,9 +1404,27 @@ void MainWindow::updateStatusBar() {
 }
 
 void MainWindow::injectMonitorScript() {
-  QString script = m_postMonitor->getMonitorScript(m_keywords);
-  m_searchBrowser->ExecuteJavaScript(script);
-  qDebug() << "[INFO] Monitor script injected";
+  // 之后的页面加载用新的关键词：只更新脚本前置的自动机，脚本本体不重发；
+  // 当前页面里脚本已在运行，只下发关键词，不再重新执行整个脚本
+  std::string prelude = m_postMonitor->getMonitorPrelude(m_keywords);
+  m_searchBrowser->SetStartupPrelude(prelude);
+  std::string update = m_postMonitor->getKeywordsUpdateScript(m_keywords);
+  m_searchBrowser->ExecuteJavaScript(update);
+  xfDebug(lcMonitor) << "Monitor keywords updated"
+                     << Logger::kv("bytes", int(prelude.size() + update.size()));
+}
+
+void MainWindow::registerStartupScripts() {
+  // 扫描脚本在每次页面加载的文档开始时由渲染进程执行，
+  // 从一开始就监听 DOM，节点出现即检测，不再等 loadFinished 后注入再固定延迟
+  m_searchBrowser->SetStartupPrelude(
+      m_postMonitor->getMonitorPrelude(m_keywords));
+  m_searchBrowser->SetStartupScript("monitor",
+                                    m_postMonitor->getMonitorScript());
+  m_followersBrowser->SetStartupScript(
+      "followers", m_postMonitor->getFollowersMonitorScript());
+  m_followBackDetectBrowser->SetStartupScript(
+      "followback", m_postMonitor->getFollowBackDetectScript());
 }
 
 void MainWindow::addPinnedAuthorPost() {
@@ -1252,8 +1502,9 @@ void MainWindow::startCooldown() {
   // 在冷却期间开始回关检查（延迟第一个检查间隔后开始）
   QTimer::singleShot(checkInterval, this, &MainWindow::startFollowBackCheck);
 
-  qDebug() << "[INFO] Cooldown started:" << randomCooldown
-           << "seconds, check interval:" << checkInterval / 1000 << "seconds";
+  xfInfo(lcFollow) << "Cooldown started:" << randomCooldown
+                   << "seconds, check interval:" << checkInterval / 1000
+                   << "seconds";
 }
 
 void MainWindow::onCooldownTick() {
@@ -1266,7 +1517,7 @@ void MainWindow::onCooldownTick() {
     m_cooldownLabel->setVisible(false);
     m_postListPanel->setEnabled(true);
     m_statusLabel->setText("状态: 冷却结束，可以继续关注");
-    qDebug() << "[INFO] Cooldown ended";
+    xfInfo(lcFollow) << "Cooldown ended";
 
     // 如果自动关注开启，继续处理下一个
     if (m_isAutoFollowing) {
@@ -1345,7 +1596,7 @@ void MainWindow::onFollowedAuthorDoubleClicked(int row, int column) {
     m_userBrowser->setVisible(true);
     QString profilePath = m_dataStorage->getProfilePath();
     QString userUrl = QString("https://x.com/%1").arg(authorHandle);
-    qDebug() << "[INFO] Creating user browser for viewing:" << authorHandle;
+    xfInfo(lcUi) << "Creating user browser for viewing:" << authorHandle;
     m_userBrowser->CreateBrowserWithProfile(userUrl, profilePath);
   } else {
     // 浏览器已初始化，直接加载URL（不触发自动关注）
@@ -1354,25 +1605,27 @@ void MainWindow::onFollowedAuthorDoubleClicked(int row, int column) {
   }
 
   // 注意：不设置 m_currentFollowingHandle，所以不会触发自动关注
-  qDebug() << "[INFO] Viewing followed author:" << authorHandle;
+  xfInfo(lcUi) << "Viewing followed author:" << authorHandle;
 }
 
 void MainWindow::onKeywordDoubleClicked(const QString &keyword) {
-  qDebug() << "[INFO] Keyword double-clicked:" << keyword;
+  xfInfo(lcMonitor) << "Keyword double-clicked:" << keyword;
 
-  // 构建Latest搜索URL (f=live表示Latest/最新)
-  QString encodedKeyword = QUrl::toPercentEncoding(keyword);
+  // 构建Latest搜索URL（单个关键词）
   QString searchUrl =
-      QString("https://x.com/search?q=%1%20filter%3Ablue_verified&f=live")
-          .arg(encodedKeyword);
+      QueryPlanner::buildSearchUrl(QueryPlanner::buildQuery({keyword}));
 
   m_statusLabel->setText(
       QString("状态: 正在搜索关键词 \"%1\" 的最新帖子...").arg(keyword));
 
   // 左侧浏览器加载搜索页面
   if (m_searchBrowserInitialized && m_searchBrowser) {
+    int index = keywordIndexOf(keyword);
+    if (index >= 0) {
+      recordSearchPageLoad({index});
+    }
     m_searchBrowser->LoadUrl(searchUrl);
-    qDebug() << "[INFO] Loading search URL:" << searchUrl;
+    xfInfo(lcMonitor) << "Loading search URL:" << searchUrl;
   }
 }
 
@@ -1389,7 +1642,7 @@ void MainWindow::onAutoFollowToggled() {
   if (m_isAutoFollowing) {
     m_autoFollowBtn->setText("停止关注");
     m_statusLabel->setText("状态: 自动关注已启动");
-    qDebug() << "[INFO] Auto-follow started";
+    xfInfo(lcFollow) << "Auto-follow started";
 
     // 启动看门狗定时器
     m_watchdogCounter = 0;
@@ -1406,7 +1659,7 @@ void MainWindow::onAutoFollowToggled() {
   } else {
     m_autoFollowBtn->setText("自动关注");
     m_statusLabel->setText("状态: 自动关注已停止");
-    qDebug() << "[INFO] Auto-follow stopped";
+    xfInfo(lcFollow) << "Auto-follow stopped";
 
     // 停止看门狗定时器
     m_autoFollowWatchdog->stop();
@@ -1432,8 +1685,8 @@ void MainWindow::processNextAutoFollow() {
   for (const auto &post : m_posts) {
     if (post.authorHandle == pinnedAuthorHandle && !post.isFollowed) {
       // 固定帖子未关注，优先处理
-      qDebug() << "[INFO] Auto-follow: processing pinned author"
-               << post.authorHandle;
+      xfDebug(lcFollow) << "Auto-follow: processing pinned author"
+                        << post.authorHandle;
       m_currentFollowingHandle = post.authorHandle;
       m_statusLabel->setText(
           QString("状态: [自动] 正在关注 @%1...").arg(post.authorHandle));
@@ -1465,7 +1718,7 @@ void MainWindow::processNextAutoFollow() {
     }
 
     // 找到了，执行关注
-    qDebug() << "[INFO] Auto-follow: processing" << post.authorHandle;
+    xfDebug(lcFollow) << "Auto-follow: processing" << post.authorHandle;
     m_currentFollowingHandle = post.authorHandle;
     m_statusLabel->setText(
         QString("状态: [自动] 正在关注 @%1...").arg(post.authorHandle));
@@ -1495,39 +1748,33 @@ void MainWindow::processNextAutoFollow() {
   m_postListPanel->setEnabled(true);
   m_followedAuthorsTable->setEnabled(true);
 
-  qDebug() << "[INFO] Auto-follow completed: no more users to follow";
+  xfDebug(lcFollow) << "Auto-follow completed: no more users to follow";
 }
 
 void MainWindow::onAutoRefreshTimeout() {
-  // 获取所有启用的关键词
-  QList<Keyword> enabledKeywords;
-  for (const auto &kw : m_keywords) {
-    if (kw.isEnabled) {
-      enabledKeywords.append(kw);
-    }
-  }
-
-  if (enabledKeywords.isEmpty()) {
-    qDebug() << "[INFO] No enabled keywords, stopping auto-refresh";
+  // 启用的关键词按最大查询长度合并为 OR 查询组，按组内近期产出选择
+  // （折扣UCB，兼顾探索）
+  QList<QueryGroup> groups =
+      m_queryPlanner->plan(m_keywords, m_maxSearchQueryLength);
+  int groupIndex = m_keywordScheduler->pickGroup(m_keywords, groups);
+  if (groupIndex < 0) {
+    xfDebug(lcMonitor) << "No enabled keywords, stopping auto-refresh";
     m_autoRefreshTimer->stop();
     return;
   }
+  const QueryGroup &group = groups[groupIndex];
+  recordSearchPageLoad(group.keywordIndexes);
 
-  // 切换到下一个关键词
-  m_currentKeywordIndex = (m_currentKeywordIndex + 1) % enabledKeywords.size();
-  const QString &keyword = enabledKeywords[m_currentKeywordIndex].text;
-
-  qDebug() << "[INFO] Auto-switch to keyword:" << keyword;
+  xfDebug(lcMonitor) << "Auto-switch to query group" << groupIndex + 1 << "/"
+                     << groups.size() << ":" << group.query;
 
   // 记录日志
-  appendLog(QString("切换搜索关键词: %1").arg(keyword));
-  m_statusLabel->setText(QString("状态: 切换到关键词 \"%1\"...").arg(keyword));
+  QString keywordList = group.keywords.join(", ");
+  appendLog(QString("切换搜索关键词: %1").arg(keywordList));
+  m_statusLabel->setText(
+      QString("状态: 切换到关键词 \"%1\"...").arg(keywordList));
 
-  // 构建Latest搜索URL (f=live表示Latest/最新)
-  QString encodedKeyword = QUrl::toPercentEncoding(keyword);
-  QString searchUrl =
-      QString("https://x.com/search?q=%1%20filter%3Ablue_verified&f=live")
-          .arg(encodedKeyword);
+  QString searchUrl = QueryPlanner::buildSearchUrl(group.query);
 
   // 左侧浏览器加载新的搜索页面
   if (m_searchBrowser) {
@@ -1537,7 +1784,7 @@ void MainWindow::onAutoRefreshTimeout() {
   // 设置下一次切换时间（30-60秒随机）
   int switchInterval = 30 + (rand() % 31); // 30-60秒随机
   m_autoRefreshTimer->start(switchInterval * 1000);
-  qDebug() << "[INFO] Next keyword switch in" << switchInterval << "seconds";
+  xfDebug(lcMonitor) << "Next keyword switch in" << switchInterval << "seconds";
 }
 
 void MainWindow::startFollowBackCheck() {
@@ -1557,6 +1804,10 @@ void MainWindow::checkNextFollowBack() {
     return;
   }
 
+  // 粉丝快照可用时，先批量确认已回关的到期用户（不用逐个打开主页）；
+  // 剩下的是快照里没有的（需要打开主页确认并取关），或快照过期时的全部到期用户
+  reconcileFollowBacks();
+
   // 获取取关天数设置
   int unfollowDays = m_unfollowDaysSpinBox->value();
   int recheckDays = m_recheckDaysSpinBox->value();
@@ -1567,24 +1818,10 @@ void MainWindow::checkNextFollowBack() {
   // 按关注时间排序，从最早关注的开始检查
   Post *oldestUnchecked = nullptr;
   for (int i = 0; i < m_posts.size(); ++i) {
-    Post &post = m_posts[i];
-    // 必须是已关注的
-    if (!post.isFollowed) {
+    const Post &post = m_posts[i];
+    if (!needsFollowBackCheck(post, unfollowThreshold, recheckThreshold)) {
       continue;
     }
-    // 跳过固定作者
-    if (post.authorHandle == "4111y80y") {
-      continue;
-    }
-    // 必须关注超过指定天数
-    if (!post.followTime.isValid() || post.followTime > unfollowThreshold) {
-      continue; // 关注时间不足，跳过
-    }
-    // 检查是否超过设定天数未检查
-    if (post.lastCheckedTime.isValid() &&
-        post.lastCheckedTime > recheckThreshold) {
-      continue; // 设定天数内检查过，跳过
-    }
     // 找到最早关注的未检查用户
     if (!oldestUnchecked || post.followTime < oldestUnchecked->followTime) {
       oldestUnchecked = &m_posts[i];
@@ -1595,13 +1832,13 @@ void MainWindow::checkNextFollowBack() {
     // 没有需要检查的用户
     m_isCheckingFollowBack = false;
     m_currentCheckingHandle.clear();
-    qDebug() << "[INFO] No users need follow-back check";
+    xfInfo(lcFollow) << "No users need follow-back check";
     return;
   }
 
   // 开始检查这个用户
   m_currentCheckingHandle = oldestUnchecked->authorHandle;
-  qDebug() << "[INFO] Checking follow-back for:" << m_currentCheckingHandle;
+  xfInfo(lcFollow) << "Checking follow-back for:" << m_currentCheckingHandle;
 
   // 记录日志
   appendLog(QString("开始检查 @%1 是否回关").arg(m_currentCheckingHandle));
@@ -1622,8 +1859,68 @@ void MainWindow::checkNextFollowBack() {
   // 页面加载后会触发 onUserLoadFinished，在那里注入检查脚本
 }
 
+bool MainWindow::needsFollowBackCheck(const Post &post,
+                                      const QDateTime &unfollowThreshold,
+                                      const QDateTime &recheckThreshold) const {
+  // 必须是已关注的
+  if (!post.isFollowed) {
+    return false;
+  }
+  // 跳过固定作者
+  if (post.authorHandle == "4111y80y") {
+    return false;
+  }
+  // 必须关注超过指定天数
+  if (!post.followTime.isValid() || post.followTime > unfollowThreshold) {
+    return false; // 关注时间不足，跳过
+  }
+  // 检查是否超过设定天数未检查
+  if (post.lastCheckedTime.isValid() &&
+      post.lastCheckedTime > recheckThreshold) {
+    return false; // 设定天数内检查过，跳过
+  }
+  return true;
+}
+
+int MainWindow::reconcileFollowBacks() {
+  QDateTime now = QDateTime::currentDateTime();
+  if (!m_followBackReconciler->isSnapshotUsable(now)) {
+    return 0;
+  }
+
+  QDateTime unfollowThreshold = now.addDays(-m_unfollowDaysSpinBox->value());
+  QDateTime recheckThreshold = now.addDays(-m_recheckDaysSpinBox->value());
+
+  // 一次集合查询：在快照里的就是已回关，记录检查时间
+  int confirmed = 0;
+  int remaining = 0;
+  for (auto &post : m_posts) {
+    if (!needsFollowBackCheck(post, unfollowThreshold, recheckThreshold)) {
+      continue;
+    }
+    if (m_followBackReconciler->followsBack(post.authorHandle)) {
+      post.lastCheckedTime = now;
+      confirmed++;
+    } else {
+      remaining++;
+    }
+  }
+
+  if (confirmed > 0) {
+    m_dataStorage->savePosts(m_posts);
+    appendLog(QString("粉丝快照确认 %1 人已回关，%2 人需要打开主页确认")
+                  .arg(confirmed)
+                  .arg(remaining));
+  }
+  xfInfo(lcFollow) << "[RECONCILE]" << Logger::kv("confirmed", confirmed)
+                   << Logger::kv("remaining", remaining)
+                   << Logger::kv("snapshot",
+                                 m_followBackReconciler->snapshotSize());
+  return confirmed;
+}
+
 void MainWindow::onCheckFollowsBack(const QString &userHandle) {
-  qDebug() << "[INFO] User follows back:" << userHandle;
+  xfInfo(lcFollow) << "User follows back:" << userHandle;
 
   // 记录日志
   appendLog(QString("@%1 已回关").arg(userHandle));
@@ -1663,7 +1960,7 @@ void MainWindow::onCheckFollowsBack(const QString &userHandle) {
 }
 
 void MainWindow::onCheckNotFollowBack(const QString &userHandle) {
-  qDebug() << "[WARNING] User does NOT follow back:" << userHandle;
+  xfWarning(lcFollow) << "User does NOT follow back:" << userHandle;
 
   // 计算关注了多少天
   int followedDays = 0;
@@ -1689,12 +1986,11 @@ void MainWindow::onCheckNotFollowBack(const QString &userHandle) {
       QString("状态: @%1 没有回关，正在取消关注...").arg(userHandle));
 
   // 执行取消关注脚本（取消关注完成后会停止检查）
-  QString script = m_autoFollower->getUnfollowScript();
-  m_userBrowser->ExecuteJavaScript(script);
+  m_userBrowser->ExecuteJavaScript(m_autoFollower->getUnfollowScript());
 }
 
 void MainWindow::onCheckSuspended(const QString &userHandle) {
-  qDebug() << "[WARNING] Account suspended during check:" << userHandle;
+  xfWarning(lcFollow) << "Account suspended during check:" << userHandle;
 
   // 记录日志
   appendLog(QString("@%1 账号被封禁").arg(userHandle));
@@ -1710,9 +2006,11 @@ void MainWindow::onCheckSuspended(const QString &userHandle) {
   // 删除该用户的所有帖子
   for (int i = m_posts.size() - 1; i >= 0; --i) {
     if (m_posts[i].authorHandle == userHandle) {
+      m_searchIndex.remove(m_posts[i].postId);
       m_posts.removeAt(i);
     }
   }
+  m_followerSourceScheduler->removeSource(userHandle);
   m_dataStorage->savePosts(m_posts);
   m_postListPanel->setPosts(m_posts);
   updateStatusBar();
@@ -1737,7 +2035,7 @@ void MainWindow::onCheckSuspended(const QString &userHandle) {
 }
 
 void MainWindow::onCheckNotFollowing(const QString &userHandle) {
-  qDebug() << "[INFO] Not following user:" << userHandle;
+  xfInfo(lcFollow) << "Not following user:" << userHandle;
 
   // 更新记录，标记为未关注
   for (int i = 0; i < m_posts.size(); ++i) {
@@ -1746,6 +2044,7 @@ void MainWindow::onCheckNotFollowing(const QString &userHandle) {
       m_posts[i].lastCheckedTime = QDateTime::currentDateTime();
     }
   }
+  m_followerSourceScheduler->removeSource(userHandle);
   m_dataStorage->savePosts(m_posts);
   m_postListPanel->setPosts(m_posts);
   updateStatusBar();
@@ -1778,7 +2077,7 @@ void MainWindow::onCheckNotFollowing(const QString &userHandle) {
 }
 
 void MainWindow::onUnfollowSuccess(const QString &userHandle) {
-  qDebug() << "[INFO] Unfollow success:" << userHandle;
+  xfInfo(lcFollow) << "Unfollow success:" << userHandle;
 
   // 记录日志
   appendLog(QString("已取消关注 @%1").arg(userHandle));
@@ -1795,9 +2094,11 @@ void MainWindow::onUnfollowSuccess(const QString &userHandle) {
   // 删除该用户的所有帖子记录（从去重中释放，后续可以重新关注）
   for (int i = m_posts.size() - 1; i >= 0; --i) {
     if (m_posts[i].authorHandle.compare(userHandle, Qt::CaseInsensitive) == 0) {
+      m_searchIndex.remove(m_posts[i].postId);
       m_posts.removeAt(i);
     }
   }
+  m_followerSourceScheduler->removeSource(userHandle);
   m_dataStorage->savePosts(m_posts);
   m_postListPanel->setPosts(m_posts);
   updateStatusBar();
@@ -1822,7 +2123,7 @@ void MainWindow::onUnfollowSuccess(const QString &userHandle) {
 }
 
 void MainWindow::onUnfollowFailed(const QString &userHandle) {
-  qDebug() << "[ERROR] Unfollow failed:" << userHandle;
+  xfWarning(lcFollow) << "Unfollow failed:" << userHandle;
 
   // 记录日志
   appendLog(QString("取消关注 @%1 失败").arg(userHandle));
@@ -1904,7 +2205,7 @@ void MainWindow::startSleep() {
   // 启动休眠计时器
   m_sleepTimer->start(1000);
 
-  qDebug() << "[INFO] Sleep started: 30 minutes";
+  xfInfo(lcFollow) << "Sleep started: 30 minutes";
 }
 
 void MainWindow::onSleepTick() {
@@ -1925,7 +2226,7 @@ void MainWindow::onSleepTick() {
     appendLog("休眠结束，继续自动关注");
     m_statusLabel->setText("状态: 休眠结束，继续自动关注");
 
-    qDebug() << "[INFO] Sleep ended, resuming auto-follow";
+    xfInfo(lcFollow) << "Sleep ended, resuming auto-follow";
 
     // 继续自动关注
     if (m_isAutoFollowing) {
@@ -1942,7 +2243,7 @@ void MainWindow::onSleepTick() {
 
     // 在休眠期间也进行取消关注检查（每60秒检查一次，均匀分布）
     if (!m_isCheckingFollowBack && m_remainingSleepSeconds % 60 == 0) {
-      qDebug() << "[INFO] Sleep period: checking for follow-back...";
+      xfInfo(lcFollow) << "Sleep period: checking for follow-back...";
       m_isCheckingFollowBack = true;
       m_followBackCheckCount = 0;
       checkNextFollowBack();
@@ -1951,15 +2252,13 @@ void MainWindow::onSleepTick() {
 }
 
 void MainWindow::onFollowersBrowserCreated() {
-  qDebug() << "[INFO] Followers browser created";
+  xfInfo(lcMonitor) << "Followers browser created";
   appendLog("粉丝浏览器已创建，等待页面加载...");
 }
 
 void MainWindow::onFollowersLoadFinished(bool success) {
   if (success) {
-    qDebug() << "[INFO] Followers page loaded";
-    // 注入粉丝监控脚本
-    injectFollowersMonitorScript();
+    xfDebug(lcMonitor) << "Followers page loaded";
 
     // 如果还没启动粉丝浏览，延迟启动
     if (!m_followersSwitchTimer->isActive()) {
@@ -1969,83 +2268,94 @@ void MainWindow::onFollowersLoadFinished(bool success) {
   }
 }
 
-void MainWindow::injectFollowersMonitorScript() {
-  QString script = m_postMonitor->getFollowersMonitorScript();
-  m_followersBrowser->ExecuteJavaScript(script);
-  qDebug() << "[INFO] Followers monitor script injected";
-}
-
 void MainWindow::startFollowersBrowsing() {
-  // 检查是否有已关注用户
-  QList<Post> followedUsers;
-  for (const auto &post : m_posts) {
-    if (post.isFollowed && post.authorHandle != "4111y80y") {
-      followedUsers.append(post);
-    }
-  }
-
-  if (followedUsers.isEmpty()) {
+  // 检查是否有已关注用户（轮换环随关注/取关增量维护）
+  if (m_followerSourceScheduler->isEmpty()) {
     appendLog("没有互关用户，暂停粉丝采集");
-    qDebug() << "[INFO] No followed users, pause followers browsing";
+    xfInfo(lcMonitor) << "No followed users, pause followers browsing";
     return;
   }
 
-  appendLog(
-      QString("开始粉丝采集，共有 %1 个互关用户").arg(followedUsers.size()));
-  qDebug() << "[INFO] Start followers browsing, total followed users:"
-           << followedUsers.size();
+  int cooling =
+      m_followerSourceScheduler->coolingCount(QDateTime::currentDateTime());
+  appendLog(QString("开始粉丝采集，共有 %1 个互关用户（%2 个产出枯竭冷却中）")
+                .arg(m_followerSourceScheduler->size())
+                .arg(cooling));
+  xfInfo(lcMonitor) << "Start followers browsing"
+                    << Logger::kv("sources", m_followerSourceScheduler->size())
+                    << Logger::kv("cooling", cooling);
 
   // 开始第一次切换
   onFollowersSwitchTimeout();
 }
 
 void MainWindow::onFollowersSwitchTimeout() {
-  // 获取已关注用户列表
-  QList<Post> followedUsers;
-  for (const auto &post : m_posts) {
-    if (post.isFollowed && post.authorHandle != "4111y80y") {
-      followedUsers.append(post);
+  QDateTime now = QDateTime::currentDateTime();
+
+  // 结算上一个来源的产出并持久化
+  QString previous = m_followerSourceScheduler->currentSource();
+  if (!previous.isEmpty()) {
+    m_followerSourceScheduler->finishVisit(now);
+    m_dataStorage->saveFollowerSources(m_followerSourceScheduler->saveState());
+    const FollowerSource *src = m_followerSourceScheduler->source(previous);
+    if (src && src->cooldownUntil.isValid()) {
+      appendLog(QString("@%1 的粉丝列表连续 %2 次无新用户，冷却至 %3")
+                    .arg(src->handle)
+                    .arg(src->zeroStreak)
+                    .arg(src->cooldownUntil.toString("MM-dd HH:mm")));
     }
   }
 
-  if (followedUsers.isEmpty()) {
+  if (m_followerSourceScheduler->isEmpty()) {
     appendLog("没有互关用户，暂停粉丝采集");
     m_followersSwitchTimer->stop();
     return;
   }
 
-  // 切换到下一个用户
-  m_currentFollowedUserIndex =
-      (m_currentFollowedUserIndex + 1) % followedUsers.size();
-  const Post &user = followedUsers[m_currentFollowedUserIndex];
+  // 按产出和新鲜度选择下一个来源
+  QString handle = m_followerSourceScheduler->beginNextVisit(now);
+  if (handle.isEmpty()) {
+    // 所有来源都在冷却中，30分钟后再看
+    appendLog("所有互关用户的粉丝列表都已枯竭，30分钟后重试");
+    xfDebug(lcMonitor) << "All follower sources cooling down";
+    m_followersSwitchTimer->start(30 * 60 * 1000);
+    return;
+  }
 
   // 构建粉丝页面URL
   QString followersUrl =
-      QString("https://x.com/%1/verified_followers").arg(user.authorHandle);
+      QString("https://x.com/%1/verified_followers").arg(handle);
 
-  appendLog(QString("切换到 @%1 的蓝V粉丝列表").arg(user.authorHandle));
-  qDebug() << "[INFO] Switch to followers page:" << followersUrl;
+  const FollowerSource *src = m_followerSourceScheduler->source(handle);
+  appendLog(QString("切换到 @%1 的蓝V粉丝列表（第%2次访问，累计新用户%3）")
+                .arg(handle)
+                .arg(src ? src->visits : 1)
+                .arg(src ? src->newAccounts : 0));
+  xfDebug(lcMonitor) << "Switch to followers page:" << followersUrl
+                     << "recentYield:" << (src ? src->recentYield : 0.0);
 
   m_followersBrowser->LoadUrl(followersUrl);
 
   // 设置下一次切换时间（30-60秒随机）
   int switchInterval = 30 + (rand() % 31);
   m_followersSwitchTimer->start(switchInterval * 1000);
-  qDebug() << "[INFO] Next followers switch in" << switchInterval << "seconds";
+  xfDebug(lcMonitor) << "Next followers switch in" << switchInterval
+                     << "seconds";
 }
 
-void MainWindow::onNewFollowersFound(const QString &jsonData) {
-  QJsonDocument doc = QJsonDocument::fromJson(jsonData.toUtf8());
-  if (!doc.isArray()) {
-    return;
-  }
-
+void MainWindow::onNewFollowersFound(const QJsonArray &arr) {
   // 固定作者的handle
   const QString pinnedAuthorHandle = "4111y80y";
 
-  QJsonArray arr = doc.array();
   int newCount = 0;
 
+  // 整批一个事务：作者集合只建一次，新用户最后一次性写入存储
+  QSet<QString> knownHandles;
+  for (const auto &post : m_posts) {
+    knownHandles.insert(post.authorHandle);
+  }
+  QList<Post> addedPosts;
+
   for (const auto &v : arr) {
     QJsonObject obj = v.toObject();
     QString userHandle = obj["authorHandle"].toString();
@@ -2056,15 +2366,8 @@ void MainWindow::onNewFollowersFound(const QString &jsonData) {
     }
 
     // 检查是否已存在
-    bool exists = false;
-    for (const auto &post : m_posts) {
-      if (post.authorHandle == userHandle) {
-        exists = true;
-        break;
-      }
-    }
-
-    if (!exists) {
+    if (!knownHandles.contains(userHandle)) {
+      knownHandles.insert(userHandle);
       Post post;
       post.postId = "followers_" + userHandle;
       post.authorHandle = userHandle;
@@ -2076,10 +2379,17 @@ void MainWindow::onNewFollowersFound(const QString &jsonData) {
       post.isFollowed = false;
 
       m_posts.append(post);
-      m_dataStorage->addPost(post);
+      m_searchIndex.addOrUpdate(post);
+      addedPosts.append(post);
       newCount++;
     }
   }
+  if (!addedPosts.isEmpty()) {
+    m_dataStorage->addPosts(addedPosts);
+  }
+
+  // 计入当前粉丝来源的产出
+  m_followerSourceScheduler->recordNewAccounts(newCount);
 
   if (newCount > 0) {
     // 排序优先级：1.固定帖子 2.关键词搜索账号 3.粉丝采集账号，同级按采集时间降序
@@ -2104,7 +2414,9 @@ void MainWindow::onNewFollowersFound(const QString &jsonData) {
     updateStatusBar();
     updateFollowersBrowserState(); // 更新粉丝面板数量显示
     appendLog(QString("从粉丝列表采集到 %1 个新用户").arg(newCount));
-    qDebug() << "[INFO] Found" << newCount << "new followers";
+    xfDebug(lcMonitor) << "New followers" << Logger::kv("count", newCount)
+                       << Logger::kv("source",
+                                     m_followerSourceScheduler->currentSource());
   }
 }
 
@@ -2194,7 +2506,7 @@ void MainWindow::onFollowedLastPage() {
 }
 
 void MainWindow::onUserLoggedIn() {
-  qDebug() << "[INFO] User logged in detected";
+  xfInfo(lcMonitor) << "User logged in detected";
   appendLog("检测到用户已登录");
 
   // 用户登录后，检查是否需要启动粉丝浏览器
@@ -2204,12 +2516,13 @@ void MainWindow::onUserLoggedIn() {
   if (!m_followBackDetectBrowserInitialized && m_followBackDetectBrowser) {
     m_followBackDetectBrowserInitialized = true;
     QString profilePath = m_dataStorage->getScannerProfilePath();
-    qDebug()
-        << "[INFO] Creating follow-back detect browser with scanner profile:"
+    xfInfo(lcMonitor)
+        << "Creating follow-back detect browser with scanner profile:"
         << profilePath;
     appendLog("正在初始化回关探测浏览器(小号)...");
     m_followBackDetectBrowser->CreateBrowserWithProfile(
-        "https://x.com/4111y80y/verified_followers", profilePath);
+        QString("https://x.com/%1/verified_followers").arg(m_followBackAccount),
+        profilePath);
   }
 }
 
@@ -2231,8 +2544,8 @@ void MainWindow::updateFollowersBrowserState() {
     // 有关键词账号待关注，暂停粉丝采集
     if (m_followersSwitchTimer->isActive()) {
       m_followersSwitchTimer->stop();
-      qDebug() << "[INFO] Paused followers browsing, pending keyword accounts:"
-               << pendingKeywordAccounts;
+      xfInfo(lcMonitor) << "Paused followers browsing, pending keyword accounts:"
+                        << pendingKeywordAccounts;
     }
 
     // 显示暂停提示，隐藏浏览器
@@ -2256,14 +2569,14 @@ void MainWindow::updateFollowersBrowserState() {
     if (!m_followersBrowserInitialized && m_followersBrowser) {
       m_followersBrowserInitialized = true;
       QString profilePath = m_dataStorage->getScannerProfilePath();
-      qDebug() << "[INFO] Creating followers browser with scanner profile:"
-               << profilePath;
+      xfInfo(lcMonitor) << "Creating followers browser with scanner profile:"
+                        << profilePath;
       appendLog("正在初始化粉丝浏览器(小号)...");
       m_followersBrowser->CreateBrowserWithProfile("https://x.com",
                                                    profilePath);
     } else if (!m_followersSwitchTimer->isActive()) {
       // 浏览器已初始化，启动粉丝浏览
-      qDebug() << "[INFO] Resuming followers browsing";
+      xfInfo(lcMonitor) << "Resuming followers browsing";
       appendLog("关键词账号已关注完毕，启动粉丝采集");
       startFollowersBrowsing();
     }
@@ -2283,7 +2596,7 @@ void MainWindow::onWatchdogTick() {
   if (!m_isCooldownActive && !m_isSleeping &&
       m_currentFollowingHandle.isEmpty() && !m_isCheckingFollowBack &&
       m_watchdogCounter >= 3) {
-    qDebug() << "[WATCHDOG] Auto-follow idle stuck, resuming...";
+    xfWarning(lcFollow) << "[WATCHDOG] Auto-follow idle stuck, resuming...";
     appendLog(
         QString::fromUtf8("\xe2\x9a\xa0 "
                           "\xe6\xa3\x80\xe6\xb5\x8b\xe5\x88\xb0\xe6\xb5\x81\xe7"
@@ -2296,8 +2609,8 @@ void MainWindow::onWatchdogTick() {
 
   // 情况2: 正在关注某用户但超过60秒(6次tick)未完成
   if (!m_currentFollowingHandle.isEmpty() && m_watchdogCounter >= 6) {
-    qDebug() << "[WATCHDOG] Follow operation stuck for"
-             << m_currentFollowingHandle;
+    xfWarning(lcFollow) << "[WATCHDOG] Follow operation stuck for"
+                        << m_currentFollowingHandle;
     appendLog(
         QString::fromUtf8(
             "\xe2\x9a\xa0 \xe5\x85\xb3\xe6\xb3\xa8 @%1 "
@@ -2311,7 +2624,7 @@ void MainWindow::onWatchdogTick() {
 
   // 情况3: 回关检查卡住超过60秒(6次tick)
   if (m_isCheckingFollowBack && m_watchdogCounter >= 6) {
-    qDebug() << "[WATCHDOG] Follow-back check stuck, clearing...";
+    xfWarning(lcFollow) << "[WATCHDOG] Follow-back check stuck, clearing...";
     appendLog(QString::fromUtf8(
         "\xe2\x9a\xa0 "
         "\xe5\x9b\x9e\xe5\x85\xb3\xe6\xa3\x80\xe6\x9f\xa5\xe8\xb6\x85\xe6\x97"
@@ -2338,19 +2651,33 @@ void MainWindow::onWatchdogTick() {
 // ===== 回关探测浏览器槽函数 =====
 
 void MainWindow::onFollowBackDetectBrowserCreated() {
-  qDebug() << "[INFO] Follow-back detect browser created";
+  xfInfo(lcMonitor) << "Follow-back detect browser created";
   appendLog("回关探测浏览器创建成功");
 }
 
 void MainWindow::onFollowBackDetectLoadFinished(bool success) {
   if (success) {
-    qDebug() << "[INFO] Follow-back detect page loaded, injecting script";
-    appendLog("回关探测页面加载成功，注入检测脚本");
-    injectFollowBackDetectScript();
+    xfDebug(lcMonitor) << "Follow-back detect page loaded";
+    appendLog("回关探测页面加载成功");
     // 启动定时刷新
     if (!m_followBackDetectTimer->isActive()) {
       m_followBackDetectTimer->start();
     }
+
+    // 页面重新加载会中断正在进行的快照扫描
+    QDateTime now = QDateTime::currentDateTime();
+    if (m_followBackReconciler->isScanning()) {
+      m_followBackReconciler->finishScan(false, now);
+    }
+    // 快照到期：滚动整个粉丝列表重建快照
+    if (m_followBackReconciler->isSnapshotDue(now)) {
+      m_followBackReconciler->beginScan(now);
+      m_followBackDetectBrowser->MarkActivity();
+      m_followBackDetectBrowser->ExecuteJavaScript(
+          QString("window.xfollowing&&xfollowing.startSnapshot&&"
+                  "xfollowing.startSnapshot();"));
+      appendLog("开始扫描完整粉丝列表（回关对账）");
+    }
   } else {
     appendLog("回关探测页面加载失败");
   }
@@ -2362,6 +2689,17 @@ void MainWindow::onFollowBackDetectRefresh() {
   if (!m_refreshCountdownTimer->isActive())
     m_refreshCountdownTimer->start();
 
+  // 快照扫描进行中不刷新（刷新会中断滚动），超过上限认为扫描卡住
+  if (m_followBackReconciler->isScanning()) {
+    QDateTime now = QDateTime::currentDateTime();
+    if (m_followBackReconciler->scanStartedAt().secsTo(now) <
+        qint64(FollowBackReconciler::MAX_SCAN_MINUTES) * 60) {
+      xfDebug(lcMonitor) << "Follower snapshot in progress, skip refresh";
+      return;
+    }
+    m_followBackReconciler->finishScan(false, now);
+  }
+
   // 重新加载页面以获取最新粉丝列表
   if (m_followBackDetectBrowser) {
     appendLog(QString::fromUtf8(
@@ -2372,19 +2710,217 @@ void MainWindow::onFollowBackDetectRefresh() {
   }
 }
 
-void MainWindow::injectFollowBackDetectScript() {
-  if (m_followBackDetectBrowser && m_postMonitor) {
-    QString script = m_postMonitor->getFollowBackDetectScript();
-    m_followBackDetectBrowser->ExecuteJavaScript(script);
+void MainWindow::onFollowerSnapshotReceived(const QJsonArray &handles) {
+  m_followBackReconciler->addScanHandles(handles);
+  // 扫描期间保持页面活跃，不进入隐藏节流
+  m_followBackDetectBrowser->MarkActivity();
+}
+
+void MainWindow::onFollowerSnapshotDone(bool complete, int count) {
+  m_followBackReconciler->finishScan(complete, QDateTime::currentDateTime());
+  if (complete) {
+    m_dataStorage->saveFollowerSnapshot(m_followBackReconciler->saveState());
+    appendLog(QString("粉丝列表扫描完成: %1 人").arg(count));
+    reconcileFollowBacks();
+  } else {
+    appendLog(QString("粉丝列表扫描未完成（%1 人），回关检查继续逐个打开主页")
+                  .arg(count));
   }
 }
 
-void MainWindow::onNewFollowBackDetected(const QString &jsonData) {
-  QJsonDocument doc = QJsonDocument::fromJson(jsonData.toUtf8());
-  if (!doc.isArray())
+void MainWindow::onNewFollowBackDetected(const QJsonArray &arr) {
+  // 探测页每次刷新都会上报顶部一屏的全部粉丝，和持久化的粉丝快照归并，
+  // 只有快照里没有的才是新粉丝
+  QStringList visible;
+  for (const auto &v : arr) {
+    visible.append(v.toObject()["handle"].toString());
+  }
+  // 快照扫描期间滚过的是整个列表（接口抓取的分页同理），只收进本次扫描，
+  // 新增/减少等扫描完成后和上一份快照比较
+  if (m_followBackReconciler->isScanning()) {
+    m_followBackReconciler->addScanHandles(QJsonArray::fromStringList(visible));
+    return;
+  }
+  QStringList added = m_followBackReconciler->observeFollowers(
+      visible, QDateTime::currentDateTime());
+  if (added.isEmpty()) {
+    xfDebug(lcMonitor) << "Follow-back scan: no new followers"
+                       << Logger::kv("visible", arr.size());
+    return;
+  }
+  m_dataStorage->saveFollowerSnapshot(m_followBackReconciler->saveState());
+
+  QSet<QString> addedKeys;
+  for (const auto &handle : added) {
+    addedKeys.insert(handle.toLower());
+  }
+  QJsonArray newFollowers;
+  for (const auto &v : arr) {
+    if (addedKeys.contains(v.toObject()["handle"].toString().toLower())) {
+      newFollowers.append(v);
+    }
+  }
+  processNewFollowBacks(newFollowers);
+}
+
+void MainWindow::onFollowersGained(const QStringList &handles) {
+  // 完整扫描才发现的新粉丝（两次扫描之间没出现在列表顶部），检测时间按现在计
+  QString now = QDateTime::currentDateTime().toString(Qt::ISODate);
+  QJsonArray arr;
+  for (const auto &handle : handles) {
+    QJsonObject follower;
+    follower["handle"] = handle;
+    follower["detectedTime"] = now;
+    arr.append(follower);
+  }
+  appendLog(QString("粉丝列表扫描发现 %1 个新粉丝").arg(handles.size()));
+  processNewFollowBacks(arr);
+}
+
+void MainWindow::onFollowersLost(const QStringList &handles) {
+  // 取消关注我们的用户：清除上次回关检查时间，回关检查会尽快打开主页确认并取关
+  QSet<QString> lostKeys;
+  for (const auto &handle : handles) {
+    lostKeys.insert(handle.toLower());
+  }
+  int followed = 0;
+  for (auto &post : m_posts) {
+    if (post.isFollowed && lostKeys.contains(post.authorHandle.toLower()) &&
+        post.lastCheckedTime.isValid()) {
+      post.lastCheckedTime = QDateTime();
+      followed++;
+    }
+  }
+  if (followed > 0) {
+    m_dataStorage->savePosts(m_posts);
+  }
+
+  QStringList preview = handles.mid(0, 10);
+  appendLog(QString("粉丝减少 %1 人: @%2%3")
+                .arg(handles.size())
+                .arg(preview.join(", @"))
+                .arg(handles.size() > preview.size() ? " ..." : ""));
+  xfInfo(lcFollow) << "[FOLLOWERS_LOST]" << Logger::kv("count", handles.size())
+                   << Logger::kv("recheck", followed);
+}
+
+void MainWindow::onApiResponseCaptured(const QString &role,
+                                       const QString &operation,
+                                       const QByteArray &body) {
+  QElapsedTimer timer;
+  timer.start();
+  TimelineParser::Result result = TimelineParser::parse(body);
+  qint64 parseUs = timer.nsecsElapsed() / 1000;
+
+  CaptureCoverage &coverage = m_captureCoverage[role];
+  coverage.noteResponse(body.size(), parseUs, result.posts.size(),
+                        result.users.size());
+  if (!result.ok) {
+    xfWarning(lcMonitor) << "Captured response is not valid JSON"
+                         << Logger::kv("role", role)
+                         << Logger::kv("operation", operation)
+                         << Logger::kv("bytes", body.size());
     return;
+  }
+  xfDebug(lcMonitor) << "Captured" << operation << Logger::kv("role", role)
+                     << Logger::kv("posts", result.posts.size())
+                     << Logger::kv("users", result.users.size())
+                     << Logger::kv("parseUs", parseUs);
+
+  qint64 nowMs = QDateTime::currentMSecsSinceEpoch();
+  QStringList ids;
+  if (role == "search") {
+    QJsonArray batch = capturedPostsToBatch(result.posts);
+    for (const auto &v : batch) {
+      QString postId = v.toObject()["postId"].toString();
+      if (!postId.contains("_mention_")) {
+        ids.append(postId);
+      }
+    }
+    coverage.noteCaptured(ids, nowMs);
+    if (!batch.isEmpty()) {
+      onNewPostsFound(batch);
+    }
+  } else if (role == "followers") {
+    // 与 followers.js 相同：只要蓝V，已关注我的跳过
+    QJsonArray batch;
+    for (const auto &v : result.users) {
+      const QJsonObject user = v.toObject();
+      if (!user["verified"].toBool() || user["followedBy"].toBool()) {
+        continue;
+      }
+      QString handle = user["handle"].toString();
+      QJsonObject follower;
+      follower["authorHandle"] = handle;
+      follower["authorName"] = user["name"].toString();
+      follower["authorUrl"] = "https://x.com/" + handle;
+      batch.append(follower);
+      ids.append(handle);
+    }
+    coverage.noteCaptured(ids, nowMs);
+    if (!batch.isEmpty()) {
+      onNewFollowersFound(batch);
+    }
+  } else if (role == "followback") {
+    // 自己的粉丝列表：列表里的都是粉丝
+    QString detectedTime = QDateTime::currentDateTime().toString(Qt::ISODate);
+    QJsonArray batch;
+    for (const auto &v : result.users) {
+      const QJsonObject user = v.toObject();
+      QJsonObject follower;
+      follower["handle"] = user["handle"].toString();
+      follower["name"] = user["name"].toString();
+      follower["detectedTime"] = detectedTime;
+      batch.append(follower);
+      ids.append(user["handle"].toString());
+    }
+    coverage.noteCaptured(ids, nowMs);
+    if (!batch.isEmpty()) {
+      onNewFollowBackDetected(batch);
+    }
+  }
+  coverage.reportIfDue(nowMs);
+}
+
+QJsonArray MainWindow::capturedPostsToBatch(const QJsonArray &posts) {
+  QJsonArray batch;
+  for (const auto &v : posts) {
+    QJsonObject post = v.toObject();
+    // 与 monitor.js parsePost 相同的筛选：蓝V、有正文、命中关键词
+    QString content = post["content"].toString();
+    if (!post["verified"].toBool() || content.isEmpty()) {
+      continue;
+    }
+    QStringList matched = m_postMonitor->matchKeywords(m_keywords, content);
+    if (matched.isEmpty()) {
+      continue;
+    }
+    post["matchedKeyword"] = matched.first();
+    post["matchedKeywords"] = QJsonArray::fromStringList(matched);
+    batch.append(post);
+
+    // 为每个@提及的用户创建一条记录
+    QString authorHandle = post["authorHandle"].toString();
+    for (const auto &m : post["mentionedUsers"].toArray()) {
+      QString mentionHandle = m.toString();
+      QJsonObject mention;
+      mention["postId"] =
+          post["postId"].toString() + "_mention_" + mentionHandle;
+      mention["authorHandle"] = mentionHandle;
+      mention["authorName"] = "@" + mentionHandle;
+      mention["authorUrl"] = "https://x.com/" + mentionHandle;
+      mention["content"] = QString("[被@] 来自 @%1 的帖子").arg(authorHandle);
+      mention["postUrl"] = post.value("postUrl");
+      mention["postTime"] = post.value("postTime");
+      mention["matchedKeyword"] = matched.first() + " (被@)";
+      mention["matchedKeywords"] = post.value("matchedKeywords");
+      batch.append(mention);
+    }
+  }
+  return batch;
+}
 
-  QJsonArray arr = doc.array();
+void MainWindow::processNewFollowBacks(const QJsonArray &arr) {
   int newFollowBackCount = 0;
   int skippedAlreadyDetected = 0;
   int skippedAlreadyUsed = 0;
@@ -2439,6 +2975,13 @@ void MainWindow::onNewFollowBackDetected(const QString &jsonData) {
         m_followBackUsers.append(fbUser);
         newFollowBackCount++;
 
+        // 关键词产出统计：回关数
+        if (Keyword *kw = keywordForPost(post)) {
+          kw->followBackCount++;
+          m_keywordPanel->updateKeywordStats(m_keywords);
+          m_keywordSaveTimer->start();
+        }
+
         appendLog(
             QString::fromUtf8(
                 "\xe2\x9c\x85 "
@@ -2602,102 +3145,24 @@ void MainWindow::tryGenerateFollowBackTweet() {
 }
 
 void MainWindow::addGeneratedTweet(const QString &tweetText) {
-  QJsonObject tweetObj;
-  tweetObj["text"] = tweetText;
-  tweetObj["status"] =
-      QString::fromUtf8("\xe6\x9c\xaa\xe5\xa4\x84\xe7\x90\x86"); // 未处理
-  tweetObj["createdAt"] = QDateTime::currentDateTime().toString(Qt::ISODate);
-  m_generatedTweets.append(tweetObj);
-  m_dataStorage->saveGeneratedTweets(m_generatedTweets);
-
-  // 新帖子插入到列表顶部（显示顺序：最新在上）
-  int dataIndex = m_generatedTweets.size() - 1;
-  QJsonObject obj = m_generatedTweets[dataIndex].toObject();
-  QString status = obj["status"].toString();
-  QString label = QString("#%1 [%2]").arg(dataIndex + 1).arg(status);
-  m_generatedTweetsList->insertItem(0, label);
-  QListWidgetItem *item = m_generatedTweetsList->item(0);
-  if (status == QString::fromUtf8("\xe5\xb7\xb2\xe5\x8f\x91\xe5\xb8\x83")) {
-    item->setForeground(QColor(0, 180, 0));
-  } else if (status ==
-             QString::fromUtf8("\xe5\xb7\xb2\xe8\xb7\xb3\xe8\xbf\x87")) {
-    item->setForeground(QColor(150, 150, 150));
-  } else {
-    item->setForeground(QColor(255, 165, 0));
-  }
-  m_generatedTweetsList->setCurrentRow(0);
+  // 新帖子插入到列表顶部（显示顺序：最新在上），只追加一条日志
+  const GeneratedTweet &tweet = m_generatedTweetModel->appendTweet(tweetText);
+  m_dataStorage->appendGeneratedTweet(tweet);
+  m_generatedTweetsList->setCurrentIndex(m_generatedTweetModel->index(0));
 }
 
-void MainWindow::updateTweetListItem(int dataIndex) {
-  if (dataIndex < 0 || dataIndex >= m_generatedTweets.size())
-    return;
-  // 显示顺序是倒序：dataIndex 0 在最后一行，最大的在第0行
-  int displayRow = m_generatedTweets.size() - 1 - dataIndex;
-  QJsonObject obj = m_generatedTweets[dataIndex].toObject();
-  QString status = obj["status"].toString();
-  QString label = QString("#%1 [%2]").arg(dataIndex + 1).arg(status);
-  if (displayRow < m_generatedTweetsList->count()) {
-    m_generatedTweetsList->item(displayRow)->setText(label);
-  } else {
-    m_generatedTweetsList->addItem(label);
-  }
-  // 根据状态设置颜色
-  QListWidgetItem *item = m_generatedTweetsList->item(displayRow);
-  if (status == QString::fromUtf8("\xe5\xb7\xb2\xe5\x8f\x91\xe5\xb8\x83")) {
-    item->setForeground(QColor(0, 180, 0));
-  } else if (status ==
-             QString::fromUtf8("\xe5\xb7\xb2\xe8\xb7\xb3\xe8\xbf\x87")) {
-    item->setForeground(QColor(150, 150, 150));
-  } else {
-    item->setForeground(QColor(255, 165, 0));
-  }
-}
-
-void MainWindow::refreshTweetList() {
-  m_generatedTweetsList->clear();
-  // 倒序添加：最新的（最大index）先加到列表顶部
-  for (int i = m_generatedTweets.size() - 1; i >= 0; --i) {
-    QJsonObject obj = m_generatedTweets[i].toObject();
-    QString status = obj["status"].toString();
-    QString label = QString("#%1 [%2]").arg(i + 1).arg(status);
-    m_generatedTweetsList->addItem(label);
-    QListWidgetItem *item =
-        m_generatedTweetsList->item(m_generatedTweetsList->count() - 1);
-    if (status == QString::fromUtf8("\xe5\xb7\xb2\xe5\x8f\x91\xe5\xb8\x83")) {
-      item->setForeground(QColor(0, 180, 0));
-    } else if (status ==
-               QString::fromUtf8("\xe5\xb7\xb2\xe8\xb7\xb3\xe8\xbf\x87")) {
-      item->setForeground(QColor(150, 150, 150));
-    } else {
-      item->setForeground(QColor(255, 165, 0));
-    }
-  }
-}
-
-void MainWindow::onGeneratedTweetClicked(int displayRow) {
-  // 显示行号转数据索引（倒序映射）
-  int dataIndex = m_generatedTweets.size() - 1 - displayRow;
-  if (dataIndex >= 0 && dataIndex < m_generatedTweets.size()) {
-    QJsonValue val = m_generatedTweets[dataIndex];
-    if (val.isObject()) {
-      m_tweetPreviewEdit->setPlainText(val.toObject()["text"].toString());
-    } else if (val.isString()) {
-      m_tweetPreviewEdit->setPlainText(val.toString());
-    }
+void MainWindow::onGeneratedTweetClicked(const QModelIndex &index) {
+  const GeneratedTweet *tweet = m_generatedTweetModel->tweetAt(index.row());
+  if (tweet) {
+    m_tweetPreviewEdit->setPlainText(tweet->text);
   }
 }
 
 void MainWindow::onTweetListContextMenu(const QPoint &pos) {
-  int displayRow = m_generatedTweetsList->currentRow();
-  if (displayRow < 0)
+  int displayRow = m_generatedTweetsList->currentIndex().row();
+  const GeneratedTweet *tweet = m_generatedTweetModel->tweetAt(displayRow);
+  if (!tweet)
     return;
-  // 显示行号转数据索引（倒序映射）
-  int dataIndex = m_generatedTweets.size() - 1 - displayRow;
-  if (dataIndex < 0 || dataIndex >= m_generatedTweets.size())
-    return;
-
-  QJsonObject obj = m_generatedTweets[dataIndex].toObject();
-  QString currentStatus = obj["status"].toString();
 
   QMenu menu(this);
   QAction *actPending = menu.addAction(
@@ -2723,24 +3188,86 @@ void MainWindow::onTweetListContextMenu(const QPoint &pos) {
   if (!selected)
     return;
 
+  GeneratedTweet::Status status;
   if (selected == actPending) {
-    obj["status"] = QString::fromUtf8("\xe6\x9c\xaa\xe5\xa4\x84\xe7\x90\x86");
+    status = GeneratedTweet::Status::Pending;
   } else if (selected == actPublished) {
-    obj["status"] = QString::fromUtf8("\xe5\xb7\xb2\xe5\x8f\x91\xe5\xb8\x83");
+    status = GeneratedTweet::Status::Published;
   } else if (selected == actSkipped) {
-    obj["status"] = QString::fromUtf8("\xe5\xb7\xb2\xe8\xb7\xb3\xe8\xbf\x87");
+    status = GeneratedTweet::Status::Skipped;
   } else if (selected == actCopy) {
-    QApplication::clipboard()->setText(obj["text"].toString());
+    QApplication::clipboard()->setText(tweet->text);
     appendLog(QString::fromUtf8(
         "\xf0\x9f\x93\x8b "
         "\xe5\xb7\xb2\xe5\xa4\x8d\xe5\x88\xb6\xe5\xb8\x96\xe5\xad\x90\xe5\x86"
         "\x85\xe5\xae\xb9\xe5\x88\xb0\xe5\x89\xaa\xe8\xb4\xb4\xe6\x9d\xbf"));
     return;
+  } else {
+    return;
+  }
+
+  // 只追加一条状态变更日志，只刷新这一行
+  int tweetId = tweet->id;
+  if (m_generatedTweetModel->setStatus(displayRow, status)) {
+    m_dataStorage->appendGeneratedTweetStatus(tweetId, status);
+  }
+}
+
+void MainWindow::recordSearchPageLoad(const QList<int> &keywordIndexes) {
+  m_keywordScheduler->recordPageLoad(m_keywords, keywordIndexes);
+  m_currentSearchKeywordIds.clear();
+  for (int index : keywordIndexes) {
+    if (index >= 0 && index < m_keywords.size()) {
+      m_currentSearchKeywordIds.insert(m_keywords[index].id);
+    }
+  }
+  m_dataStorage->saveKeywords(m_keywords);
+  m_keywordPanel->updateKeywordStats(m_keywords);
+}
+
+int MainWindow::keywordIndexOf(const QString &matchedKeyword) const {
+  // 被@帖子的关键词带 " (被@)" 后缀（capturedPostsToBatch 和 monitor.js 追加），
+  // 只去掉这个后缀，关键词本身可能含有 " ("
+  static const QString mentionSuffix = " (被@)";
+  QString text = matchedKeyword;
+  if (text.endsWith(mentionSuffix)) {
+    text.chop(mentionSuffix.size());
+  }
+  for (int i = 0; i < m_keywords.size(); ++i) {
+    if (m_keywords[i].text == text) {
+      return i;
+    }
   }
+  return -1;
+}
 
-  m_generatedTweets[dataIndex] = obj;
-  m_dataStorage->saveGeneratedTweets(m_generatedTweets);
-  updateTweetListItem(dataIndex);
+Keyword *MainWindow::keywordForPost(const Post &post) {
+  int index = keywordIndexOf(post.matchedKeyword);
+  return index >= 0 ? &m_keywords[index] : nullptr;
+}
+
+int MainWindow::attributeKeyword(const QJsonObject &postObj) const {
+  // 脚本上报帖子命中的全部关键词，取第一个属于当前搜索组的
+  QJsonArray matched = postObj["matchedKeywords"].toArray();
+  if (matched.isEmpty()) {
+    matched.append(postObj["matchedKeyword"].toString());
+  }
+  for (const auto &v : matched) {
+    int index = keywordIndexOf(v.toString());
+    if (index >= 0 && m_currentSearchKeywordIds.contains(m_keywords[index].id)) {
+      return index;
+    }
+  }
+
+  // 单关键词搜索页：X的分词匹配和脚本的子串匹配可能不一致，全部计入该关键词
+  if (m_currentSearchKeywordIds.size() == 1) {
+    for (int i = 0; i < m_keywords.size(); ++i) {
+      if (m_currentSearchKeywordIds.contains(m_keywords[i].id)) {
+        return i;
+      }
+    }
+  }
+  return -1;
 }
 
 QString MainWindow::formatDuration(qint64 seconds) {
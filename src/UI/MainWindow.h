@@ -1,13 +1,17 @@
 #ifndef MAINWINDOW_H
 #define MAINWINDOW_H
 
+#include "Core/CaptureCoverage.h"
 #include "Data/Keyword.h"
 #include "Data/Post.h"
+#include "Data/SearchIndex.h"
 #include <QCheckBox>
+#include <QHash>
+#include <QJsonArray>
 #include <QJsonObject>
 #include <QLabel>
 #include <QList>
-#include <QListWidget>
+#include <QListView>
 #include <QMainWindow>
 #include <QPushButton>
 #include <QSet>
@@ -24,7 +28,13 @@ class PostListPanel;
 class DataStorage;
 class PostMonitor;
 class AutoFollower;
+class KeywordScheduler;
+class QueryPlanner;
 class DingTalkNotifier;
+class FollowerSourceScheduler;
+class FollowBackReconciler;
+class RendererWatchdog;
+class GeneratedTweetModel;
 
 class MainWindow : public QMainWindow {
   Q_OBJECT
@@ -35,7 +45,6 @@ public:
 
 protected:
   void closeEvent(QCloseEvent *event) override;
-  void timerEvent(QTimerEvent *event) override;
   void showEvent(QShowEvent *event) override;
 
 private slots:
@@ -44,7 +53,7 @@ private slots:
   void onSearchLoadFinished(bool success);
   void onUserLoadFinished(bool success);
   void onPostClicked(const Post &post);
-  void onNewPostsFound(const QString &jsonData);
+  void onNewPostsFound(const QJsonArray &arr);
   void onFollowSuccess(const QString &userHandle);
   void onAlreadyFollowing(const QString &userHandle);
   void onFollowFailed(const QString &userHandle);
@@ -69,7 +78,7 @@ private slots:
   // 粉丝浏览器槽函数
   void onFollowersBrowserCreated();
   void onFollowersLoadFinished(bool success);
-  void onNewFollowersFound(const QString &jsonData);
+  void onNewFollowersFound(const QJsonArray &arr);
   void onFollowersSwitchTimeout();
   // 已关注用户分页槽函数
   void onFollowedFirstPage();
@@ -82,9 +91,17 @@ private slots:
   void onFollowBackDetectBrowserCreated();
   void onFollowBackDetectLoadFinished(bool success);
   void onFollowBackDetectRefresh();
-  void onNewFollowBackDetected(const QString &jsonData);
+  void onNewFollowBackDetected(const QJsonArray &arr);
+  void onFollowerSnapshotReceived(const QJsonArray &handles);
+  void onFollowerSnapshotDone(bool complete, int count);
+  void onFollowersGained(const QStringList &handles);
+  void onFollowersLost(const QStringList &handles);
+  // 接口抓取：解析后按浏览器角色转换成页面脚本的上报格式，走同一套处理
+  void onApiResponseCaptured(const QString &role, const QString &operation,
+                             const QByteArray &body);
+  // 渲染进程内存超预算，重建对应浏览器
   // 生成帖子列表交互
-  void onGeneratedTweetClicked(int row);
+  void onGeneratedTweetClicked(const QModelIndex &index);
   void onTweetListContextMenu(const QPoint &pos);
 
 private:
@@ -94,26 +111,34 @@ private:
   void saveSettings();
   void updateStatusBar();
   void injectMonitorScript();
+  void registerStartupScripts(); // 注册扫描浏览器的文档开始脚本
   void addPinnedAuthorPost();
   void startCooldown();
   void updateCooldownDisplay();
   void updateFollowedAuthorsTable();
   void startFollowBackCheck();            // 开始回关检查
   void checkNextFollowBack();             // 检查下一个用户
+  int reconcileFollowBacks();             // 用粉丝快照批量确认已回关的到期用户
+  void processNewFollowBacks(const QJsonArray &arr); // 新粉丝计入回关统计
+  QJsonArray capturedPostsToBatch(const QJsonArray &posts); // 筛选同 monitor.js
+  bool markPostHandled(const QString &postId); // 本次运行第一次处理时返回 true
+  bool needsFollowBackCheck(const Post &post,
+                            const QDateTime &unfollowThreshold,
+                            const QDateTime &recheckThreshold) const;
   void appendLog(const QString &message); // 追加日志
   void startSleep();                      // 开始休眠
-  void injectFollowersMonitorScript();    // 注入粉丝监控脚本
   void startFollowersBrowsing();          // 开始浏览粉丝
   void renderFollowedPage();              // 渲染已关注用户当前页
   void updateFollowedPageInfo();          // 更新分页信息
   void updateFollowersBrowserState();     // 更新粉丝浏览器状态
   int countPendingKeywordAccounts();      // 统计待关注的关键词账号数量
-  void injectFollowBackDetectScript();    // 注入回关探测脚本
   void tryGenerateFollowBackTweet();      // 尝试生成回关帖子
   void addGeneratedTweet(const QString &tweetText); // 添加生成的帖子
-  void updateTweetListItem(int row);                // 更新列表项显示
-  void refreshTweetList();                          // 刷新帖子列表
   QString formatDuration(qint64 seconds);           // 格式化时间差
+  void recordSearchPageLoad(const QList<int> &keywordIndexes); // 记录搜索页加载
+  int keywordIndexOf(const QString &matchedKeyword) const; // 关键词下标
+  Keyword *keywordForPost(const Post &post);       // 帖子对应的关键词
+  int attributeKeyword(const QJsonObject &postObj) const; // 产出归属的关键词
 
   // UI Components - 三栏布局
   QSplitter *m_mainSplitter;
@@ -158,7 +183,8 @@ private:
 
   // 第5列 - 生成帖子面板
   QWidget *m_tweetGenPanel;
-  QListWidget *m_generatedTweetsList; // 帖子列表
+  QListView *m_generatedTweetsList;            // 帖子列表
+  GeneratedTweetModel *m_generatedTweetModel; // 帖子列表模型
   QTextEdit *m_tweetPreviewEdit;      // 帖子预览
   QSpinBox *m_refreshIntervalSpinBox; // 回关刷新间隔
   QLabel *m_refreshCountdownLabel;    // 刷新倒计时标签
@@ -173,13 +199,16 @@ private:
   DataStorage *m_dataStorage;
   PostMonitor *m_postMonitor;
   AutoFollower *m_autoFollower;
+  KeywordScheduler *m_keywordScheduler;
+  QueryPlanner *m_queryPlanner;
 
   // 数据
   QList<Post> m_posts;
   QList<Keyword> m_keywords;
+  QJsonObject m_config; // config.json
+  SearchIndex m_searchIndex; // 帖子全文检索索引（随 m_posts 增量维护）
 
-  // CEF timer
-  int m_cefTimerId;
+  // 浏览器初始化状态
   bool m_searchBrowserInitialized;
   bool m_userBrowserInitialized;
 
@@ -198,16 +227,31 @@ private:
 
   // 自动刷新搜索页
   QTimer *m_autoRefreshTimer;
-  int m_currentKeywordIndex; // 当前关键词索引
+  QSet<QString> m_currentSearchKeywordIds; // 当前搜索页对应的关键词ID
+  QTimer *m_keywordSaveTimer; // 关键词统计变化后延迟保存（合并连续的变化）
+  static const int KEYWORD_SAVE_DELAY_MS = 5000;
+  int m_maxSearchQueryLength;              // OR 查询最大长度（config.json）
+  bool m_blockScannerResources; // 扫描类浏览器拦截图片/视频等（config.json）
+  bool m_captureResponses; // 扫描类浏览器抓取时间线接口响应（config.json）
+  QHash<QString, CaptureCoverage> m_captureCoverage; // 浏览器标签 -> 对照统计
+  // 本次运行已处理过的帖子ID（接口抓取和 DOM 两条路径共用，同一帖子只计一次
+  // 命中/产出）；两代轮换，总量不超过 HANDLED_POST_IDS_CAPACITY
+  QSet<QString> m_handledPostIds;
+  QSet<QString> m_handledPostIdsPrevious;
+  static const int HANDLED_POST_IDS_CAPACITY = 20000;
 
   // 粉丝采集
   QTimer *m_followersSwitchTimer;
-  int m_currentFollowedUserIndex; // 当前正在浏览的互关用户索引
+  FollowerSourceScheduler *m_followerSourceScheduler; // 粉丝来源调度（轮换环）
+  RendererWatchdog *m_rendererWatchdog; // 渲染进程内存看门狗
+  static const int USER_IDLE_RECYCLE_SECS = 300; // 用户浏览器无输入多久后才可重建
 
   // 回关检查
   bool m_isCheckingFollowBack;     // 是否正在检查回关
   QString m_currentCheckingHandle; // 当前正在检查的用户
   int m_followBackCheckCount;      // 本轮已检查的用户数
+  FollowBackReconciler *m_followBackReconciler; // 粉丝快照对账
+  QString m_followBackAccount; // 检查回关的账号（config.json followBackAccount）
 
   // 连续失败休眠
   int m_consecutiveFailures;   // 连续失败次数
@@ -235,7 +279,6 @@ private:
   // 回关追踪数据
   QList<QJsonObject> m_followBackUsers;    // 已回关用户（尚未生成帖子的）
   QSet<QString> m_usedFollowBackHandles;   // 已生成过帖子的用户handle（去重）
-  QJsonArray m_generatedTweets;            // 已生成的帖子 [{text, status}]
   QSet<QString> m_detectedFollowerHandles; // 已检测到的粉丝handle集合
   QJsonArray m_tweetTemplates;             // 帖子模板 [{header, footer}]
 };
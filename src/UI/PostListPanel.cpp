@@ -1,16 +1,24 @@
 #include "PostListPanel.h"
+#include "Data/SearchIndex.h"
+#include <QElapsedTimer>
 #include <QHBoxLayout>
 #include <QHeaderView>
 #include <QVBoxLayout>
 #include <algorithm>
 
 PostListPanel::PostListPanel(QWidget *parent)
-    : QWidget(parent), m_hideFollowed(false), m_currentPage(0), m_pageSize(100),
-      m_totalPages(0) {
+    : QWidget(parent), m_hideFollowed(false), m_searchEdit(nullptr),
+      m_currentPage(0), m_pageSize(100), m_totalPages(0) {
 
   QVBoxLayout *layout = new QVBoxLayout(this);
   layout->setContentsMargins(0, 0, 0, 0);
 
+  // 搜索框（按 handle / 名称 / 内容 / 关键词 过滤）
+  m_searchEdit = new QLineEdit(this);
+  m_searchEdit->setPlaceholderText("搜索 @handle / 名称 / 内容 / 关键词");
+  m_searchEdit->setClearButtonEnabled(true);
+  layout->addWidget(m_searchEdit);
+
   m_tableWidget = new QTableWidget(this);
   m_tableWidget->setColumnCount(4);
   m_tableWidget->setHorizontalHeaderLabels({"作者", "内容", "关键词", "状态"});
@@ -55,6 +63,8 @@ PostListPanel::PostListPanel(QWidget *parent)
 
   connect(m_tableWidget, &QTableWidget::cellClicked, this,
           &PostListPanel::onItemClicked);
+  connect(m_searchEdit, &QLineEdit::textChanged, this,
+          &PostListPanel::onSearchTextChanged);
   connect(m_firstBtn, &QPushButton::clicked, this, &PostListPanel::firstPage);
   connect(m_prevBtn, &QPushButton::clicked, this, &PostListPanel::prevPage);
   connect(m_nextBtn, &QPushButton::clicked, this, &PostListPanel::nextPage);
@@ -75,6 +85,17 @@ void PostListPanel::setHideFollowed(bool hide) {
   updateTable();
 }
 
+void PostListPanel::setSearchIndex(const SearchIndex *index) {
+  m_searchIndex = index;
+}
+
+void PostListPanel::onSearchTextChanged(const QString &text) {
+  m_searchText = text.trimmed();
+  // 重置到第一页
+  m_currentPage = 0;
+  updateTable();
+}
+
 void PostListPanel::updateTable() {
   m_tableWidget->setRowCount(0);
   m_filteredPosts.clear();
@@ -82,6 +103,16 @@ void PostListPanel::updateTable() {
   // 固定作者的handle，不会被隐藏
   const QString pinnedAuthorHandle = "4111y80y";
 
+  // 搜索过滤：通过倒排索引取得命中的 postId 集合
+  bool searching = !m_searchText.isEmpty() && m_searchIndex;
+  QSet<QString> matchedIds;
+  if (searching) {
+    QElapsedTimer timer;
+    timer.start();
+    matchedIds = m_searchIndex->matchingPostIds(m_searchText);
+    m_lastSearchMs = timer.nsecsElapsed() / 1e6;
+  }
+
   for (const auto &post : m_posts) {
     // 固定帖子永远显示，不会被隐藏
     bool isPinned = (post.authorHandle == pinnedAuthorHandle);
@@ -89,6 +120,9 @@ void PostListPanel::updateTable() {
     if (m_hideFollowed && post.isFollowed && !isPinned) {
       continue;
     }
+    if (searching && !matchedIds.contains(post.postId)) {
+      continue;
+    }
     m_filteredPosts.append(post);
   }
 
@@ -164,10 +198,14 @@ void PostListPanel::updateTable() {
 }
 
 void PostListPanel::updatePageInfo() {
-  m_pageLabel->setText(QString("Page %1/%2 (Total: %3)")
-                           .arg(m_currentPage + 1)
-                           .arg(m_totalPages)
-                           .arg(m_filteredPosts.size()));
+  QString info = QString("Page %1/%2 (Total: %3)")
+                     .arg(m_currentPage + 1)
+                     .arg(m_totalPages)
+                     .arg(m_filteredPosts.size());
+  if (!m_searchText.isEmpty() && m_searchIndex) {
+    info += QString(" 搜索 %1 ms").arg(m_lastSearchMs, 0, 'f', 2);
+  }
+  m_pageLabel->setText(info);
 
   // 更新按钮状态
   m_firstBtn->setEnabled(m_currentPage > 0);
@@ -5,9 +5,12 @@
 #include <QTableWidget>
 #include <QList>
 #include <QLabel>
+#include <QLineEdit>
 #include <QPushButton>
 #include "Data/Post.h"
 
+class SearchIndex;
+
 class PostListPanel : public QWidget {
     Q_OBJECT
 
@@ -16,6 +19,7 @@ public:
 
     void setPosts(const QList<Post>& posts);
     void setHideFollowed(bool hide);
+    void setSearchIndex(const SearchIndex* index);
 
 signals:
     void postClicked(const Post& post);
@@ -29,6 +33,7 @@ public slots:
 
 private slots:
     void onItemClicked(int row, int column);
+    void onSearchTextChanged(const QString& text);
 
 private:
     void updateTable();
@@ -39,6 +44,12 @@ private:
     QList<Post> m_filteredPosts;
     bool m_hideFollowed;
 
+    // 搜索过滤
+    QLineEdit* m_searchEdit;
+    QString m_searchText;
+    const SearchIndex* m_searchIndex = nullptr;
+    double m_lastSearchMs = 0.0; // 最近一次检索耗时
+
     // 分页相关
     int m_currentPage = 0;
     int m_pageSize = 100;  // 每页100条
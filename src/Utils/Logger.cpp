@@ -1,31 +1,412 @@
 #include "Logger.h"
-#include <QDebug>
+#include <QCoreApplication>
 #include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QStringList>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#ifdef Q_OS_WIN
+#include <windows.h>
+#endif
+
+Q_LOGGING_CATEGORY(lcApp, "xf.app")
+Q_LOGGING_CATEGORY(lcStorage, "xf.storage")
+Q_LOGGING_CATEGORY(lcMonitor, "xf.monitor")
+Q_LOGGING_CATEGORY(lcFollow, "xf.follow")
+Q_LOGGING_CATEGORY(lcCef, "xf.cef")
+Q_LOGGING_CATEGORY(lcUi, "xf.ui")
+Q_LOGGING_CATEGORY(lcNotify, "xf.notify")
+
+namespace {
+
+// 有界多生产者多消费者环形缓冲区（Vyukov 序号算法）；平时只有写线程/flush 在持锁时消费，
+// 崩溃处理不取锁也能安全地取出剩余条目
+class LogRing {
+public:
+    LogRing() : m_slots(new Slot[Logger::RING_CAPACITY]) {
+        for (int i = 0; i < Logger::RING_CAPACITY; ++i) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool tryPush(qint64 timestampMs, const QString& text) {
+        Slot* slot = nullptr;
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            slot = &m_slots[pos & MASK];
+            size_t seq = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // 已满
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        slot->timestampMs = timestampMs;
+        slot->text = text;
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPop(qint64& timestampMs, QString& text) {
+        Slot* slot = nullptr;
+        size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            slot = &m_slots[pos & MASK];
+            size_t seq = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos + 1);
+            if (diff == 0) {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // 空
+            } else {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        timestampMs = slot->timestampMs;
+        text = std::move(slot->text);
+        slot->text = QString();
+        slot->sequence.store(pos + Logger::RING_CAPACITY, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        qint64 timestampMs = 0;
+        QString text;
+    };
+    static const size_t MASK = Logger::RING_CAPACITY - 1;
+
+    std::unique_ptr<Slot[]> m_slots;
+    alignas(64) std::atomic<size_t> m_enqueuePos{0};
+    alignas(64) std::atomic<size_t> m_dequeuePos{0};
+};
+
+struct LoggerState {
+    LogRing ring;
+    std::atomic<quint64> dropped{0};      // 上次写入后丢弃的行数
+    std::atomic<quint64> totalDropped{0}; // 累计丢弃的行数
+
+    // 消费者（写线程 / flush / shutdown）互斥，文件也只在持锁时访问；
+    // logDir 在写线程启动前设置，之后只读
+    std::mutex consumerMutex;
+    QString logDir;
+    QFile* file = nullptr;
+    qint64 fileBytes = 0;
+    qint64 fileOpenedAtMs = 0;
+
+    std::thread writer;
+    std::mutex wakeMutex;
+    std::condition_variable wakeCv;
+    std::atomic<bool> stopRequested{false};
+    std::atomic<bool> urgent{false}; // error() 要求尽快落盘
+    std::atomic<bool> crashFlushed{false};
+    std::atomic<bool> running{false};
+};
+
+LoggerState& state() {
+    static LoggerState* s = new LoggerState(); // 不析构，崩溃/退出路径都可安全访问
+    return *s;
+}
+
+void removeOldFiles(const QString& dir) {
+    QDir logDir(dir);
+    QFileInfoList files = logDir.entryInfoList({"debug_*.log"}, QDir::Files, QDir::Name);
+    for (int i = 0; i + Logger::KEEP_FILES < files.size(); ++i) {
+        QFile::remove(files[i].absoluteFilePath());
+    }
+}
+
+// 持有 consumerMutex 时调用
+void openNewFile(LoggerState& s, qint64 nowMs) {
+    if (s.file) {
+        s.file->close();
+        delete s.file;
+        s.file = nullptr;
+    }
+    QDir().mkpath(s.logDir);
+    QString timestamp = QDateTime::fromMSecsSinceEpoch(nowMs).toString("yyyyMMdd_HHmmss");
+    QString path = s.logDir + "/debug_" + timestamp + ".log";
+    s.file = new QFile(path);
+    if (!s.file->open(QIODevice::Append | QIODevice::Text)) {
+        delete s.file;
+        s.file = nullptr;
+        return;
+    }
+    s.fileBytes = s.file->size();
+    s.fileOpenedAtMs = nowMs;
+    QByteArray header = "=== X互关宝 Debug Log Started: " +
+                        QDateTime::fromMSecsSinceEpoch(nowMs).toString().toUtf8() + " ===\n";
+    s.fileBytes += s.file->write(header);
+    removeOldFiles(s.logDir);
+}
+
+void appendLine(QByteArray& batch, qint64 timestampMs, const QString& text) {
+    batch += '[';
+    batch += QDateTime::fromMSecsSinceEpoch(timestampMs).toString("HH:mm:ss.zzz").toLatin1();
+    batch += "] ";
+    batch += text.toUtf8();
+    batch += '\n';
+}
+
+// 持有 consumerMutex 时调用，返回写入的行数
+int drainBatch(LoggerState& s, int maxLines) {
+    qint64 timestampMs = 0;
+    QString text;
+    QByteArray batch;
+    int lines = 0;
+
+    quint64 dropped = s.dropped.exchange(0);
+    if (dropped > 0) {
+        batch += "[LOGGER] ring buffer full, dropped " + QByteArray::number(dropped) + " lines\n";
+    }
+
+    while (lines < maxLines && s.ring.tryPop(timestampMs, text)) {
+        appendLine(batch, timestampMs, text);
+        lines++;
+    }
+    if (batch.isEmpty()) {
+        return 0;
+    }
+
+    qint64 nowMs = QDateTime::currentMSecsSinceEpoch();
+    if (!s.file || s.fileBytes >= Logger::MAX_FILE_BYTES ||
+        nowMs - s.fileOpenedAtMs >= Logger::MAX_FILE_AGE_SECS * 1000) {
+        openNewFile(s, nowMs);
+    }
+    if (s.file) {
+        s.fileBytes += s.file->write(batch);
+        s.file->flush(); // 每批一次，而不是每行一次
+    }
+    return lines;
+}
+
+void drainAll(LoggerState& s) {
+    while (drainBatch(s, Logger::WRITE_BATCH) > 0) {
+    }
+}
+
+void writerLoop() {
+    LoggerState& s = state();
+    for (;;) {
+        int lines = 0;
+        {
+            std::lock_guard<std::mutex> lock(s.consumerMutex);
+            lines = drainBatch(s, Logger::WRITE_BATCH);
+        }
+        if (lines >= Logger::WRITE_BATCH) {
+            continue; // 还有积压，继续写
+        }
+        if (s.stopRequested.load()) {
+            break;
+        }
+        // 空闲时等待一个批量窗口；缓冲区满或 error() 时由生产者提前唤醒
+        std::unique_lock<std::mutex> lock(s.wakeMutex);
+        s.wakeCv.wait_for(lock, std::chrono::milliseconds(Logger::WRITER_IDLE_MS),
+                          [&s]() { return s.urgent.load() || s.stopRequested.load(); });
+        s.urgent.store(false);
+    }
+}
+
+// 崩溃时在出错线程上把缓冲区里还能取出的日志写进单独的 debug_*_crash.log：
+// 不取 consumerMutex（崩溃的可能正是持锁的写线程），也不碰写线程的 QFile，
+// 写线程正在写的那一批以它自己的文件为准
+void flushOnCrash() {
+    LoggerState& s = state();
+    if (s.logDir.isEmpty() || s.crashFlushed.exchange(true)) {
+        return;
+    }
+    qint64 nowMs = QDateTime::currentMSecsSinceEpoch();
+    QString path = s.logDir + "/debug_" +
+                   QDateTime::fromMSecsSinceEpoch(nowMs).toString("yyyyMMdd_HHmmss") + "_crash.log";
+    std::FILE* file = std::fopen(QDir::toNativeSeparators(path).toLocal8Bit().constData(), "ab");
+    if (!file) {
+        return;
+    }
+    QByteArray batch = "=== crash detected, unwritten log lines ===\n";
+    qint64 timestampMs = 0;
+    QString text;
+    while (s.ring.tryPop(timestampMs, text)) {
+        appendLine(batch, timestampMs, text);
+    }
+    std::fwrite(batch.constData(), 1, size_t(batch.size()), file);
+    std::fclose(file);
+}
+
+std::terminate_handler g_previousTerminate = nullptr;
+
+void onTerminate() {
+    flushOnCrash();
+    if (g_previousTerminate) {
+        g_previousTerminate();
+    }
+    std::abort();
+}
+
+#ifdef Q_OS_WIN
+LPTOP_LEVEL_EXCEPTION_FILTER g_previousFilter = nullptr;
+
+LONG WINAPI onUnhandledException(EXCEPTION_POINTERS* info) {
+    flushOnCrash();
+    return g_previousFilter ? g_previousFilter(info) : EXCEPTION_CONTINUE_SEARCH;
+}
+#endif
+
+void enqueue(const QString& msg) {
+    LoggerState& s = state();
+    if (!s.ring.tryPush(QDateTime::currentMSecsSinceEpoch(), msg)) {
+        s.dropped.fetch_add(1, std::memory_order_relaxed);
+        s.totalDropped.fetch_add(1, std::memory_order_relaxed);
+        s.wakeCv.notify_one();
+    }
+}
+
+QtMessageHandler g_previousHandler = nullptr;
+
+// 所有 Qt 日志（含分类日志）统一加上级别和分类写入文件，再交给原处理器输出到控制台
+void messageHandler(QtMsgType type, const QMessageLogContext& context, const QString& msg) {
+    const char* level = "D";
+    switch (type) {
+        case QtDebugMsg: level = "D"; break;
+        case QtInfoMsg: level = "I"; break;
+        case QtWarningMsg: level = "W"; break;
+        case QtCriticalMsg: level = "E"; break;
+        case QtFatalMsg: level = "F"; break;
+    }
+    if (context.category && std::strcmp(context.category, "default") != 0) {
+        enqueue(QString("[%1] %2: %3").arg(QLatin1String(level), QLatin1String(context.category), msg));
+    } else {
+        enqueue(QString("[%1] %2").arg(QLatin1String(level), msg));
+    }
+
+    if (type == QtFatalMsg) {
+        flushOnCrash();
+    }
+    if (g_previousHandler) {
+        g_previousHandler(type, context, msg);
+    }
+}
+
+} // namespace
 
 namespace Logger {
 
-void init() {
-    // 日志初始化在CefHandler中完成
+void init(const QString& logDir) {
+    LoggerState& s = state();
+    if (s.running.exchange(true)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(s.consumerMutex);
+        s.logDir = logDir.isEmpty() ? QCoreApplication::applicationDirPath() + "/logs" : logDir;
+    }
+    s.stopRequested.store(false);
+    s.writer = std::thread(writerLoop);
+
+    g_previousHandler = qInstallMessageHandler(messageHandler);
+    g_previousTerminate = std::set_terminate(onTerminate);
+#ifdef Q_OS_WIN
+    g_previousFilter = SetUnhandledExceptionFilter(onUnhandledException);
+#endif
+    xfInfo(lcApp) << "Async logger started" << kv("dir", s.logDir);
+}
+
+void applyLevels(const QJsonObject& levels) {
+    const QStringList order = {"debug", "info", "warning", "critical"};
+    QStringList rules;
+    for (auto it = levels.constBegin(); it != levels.constEnd(); ++it) {
+        QString category = it.key() == "*" ? "xf.*" : "xf." + it.key();
+        QString level = it.value().toString().toLower();
+        int minIndex = level == "off" ? order.size() : order.indexOf(level);
+        if (minIndex < 0) {
+            xfWarning(lcApp) << "Unknown log level" << kv("category", it.key()) << kv("level", level);
+            continue;
+        }
+        for (int i = 0; i < order.size(); ++i) {
+            rules << QString("%1.%2=%3").arg(category, order[i], i >= minIndex ? "true" : "false");
+        }
+    }
+    if (!rules.isEmpty()) {
+        QLoggingCategory::setFilterRules(rules.join('\n'));
+        xfInfo(lcApp) << "Log levels applied" << kv("rules", rules.size());
+    }
+}
+
+void shutdown() {
+    LoggerState& s = state();
+    if (!s.running.exchange(false)) {
+        return;
+    }
+    qInstallMessageHandler(g_previousHandler);
+    s.stopRequested.store(true);
+    s.wakeCv.notify_one();
+    if (s.writer.joinable()) {
+        s.writer.join();
+    }
+    std::lock_guard<std::mutex> lock(s.consumerMutex);
+    drainAll(s);
+    if (s.file) {
+        s.file->close();
+        delete s.file;
+        s.file = nullptr;
+    }
 }
 
+void flush() {
+    LoggerState& s = state();
+    std::lock_guard<std::mutex> lock(s.consumerMutex);
+    if (!s.logDir.isEmpty()) {
+        drainAll(s);
+    }
+}
+
+void write(const QString& msg) {
+    enqueue(msg);
+}
+
+// 消息处理器负责写文件，这里只按级别转成分类日志
 void log(const QString& msg) {
-    qDebug() << msg;
+    xfInfo(lcApp).noquote() << msg;
 }
 
 void debug(const QString& msg) {
-    qDebug() << "[DEBUG]" << msg;
+    xfDebug(lcApp).noquote() << msg;
 }
 
 void info(const QString& msg) {
-    qDebug() << "[INFO]" << msg;
+    xfInfo(lcApp).noquote() << msg;
 }
 
 void warning(const QString& msg) {
-    qWarning() << "[WARNING]" << msg;
+    xfWarning(lcApp).noquote() << msg;
 }
 
 void error(const QString& msg) {
-    qCritical() << "[ERROR]" << msg;
+    xfCritical(lcApp).noquote() << msg;
+    // 错误日志尽快落盘：唤醒写线程，不在调用线程上写文件
+    LoggerState& s = state();
+    s.urgent.store(true);
+    s.wakeCv.notify_one();
+}
+
+quint64 droppedCount() {
+    return state().totalDropped.load();
 }
 
 } // namespace Logger
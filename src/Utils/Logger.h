@@ -1,15 +1,107 @@
 #ifndef LOGGER_H
 #define LOGGER_H
 
+#include <QDebug>
+#include <QJsonObject>
+#include <QLoggingCategory>
 #include <QString>
 
+// 日志分类（规则名 xf.<分类>，可在 config.json 的 logLevels 中按分类设置级别）
+Q_DECLARE_LOGGING_CATEGORY(lcApp)     // xf.app     启动/退出等
+Q_DECLARE_LOGGING_CATEGORY(lcStorage) // xf.storage 数据读写/备份/迁移
+Q_DECLARE_LOGGING_CATEGORY(lcMonitor) // xf.monitor 搜索/粉丝采集/回关探测
+Q_DECLARE_LOGGING_CATEGORY(lcFollow)  // xf.follow  关注/取关/回关检查/冷却
+Q_DECLARE_LOGGING_CATEGORY(lcCef)     // xf.cef     浏览器/消息泵/脚本通道
+Q_DECLARE_LOGGING_CATEGORY(lcUi)      // xf.ui      界面操作
+Q_DECLARE_LOGGING_CATEGORY(lcNotify)  // xf.notify  钉钉通知
+
+// 编译期最低级别：0=debug 1=info 2=warning 3=critical
+// 低于该级别的 xfXxx() 调用展开为 while(false)，参数不会被求值，Release 默认去掉 debug
+#ifndef XF_LOG_MIN_LEVEL
+#ifdef QT_NO_DEBUG
+#define XF_LOG_MIN_LEVEL 1
+#else
+#define XF_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+// 运行期：分类的级别未启用时 qCDebug 等不会格式化参数
+#if XF_LOG_MIN_LEVEL <= 0
+#define xfDebug(category) qCDebug(category)
+#else
+#define xfDebug(category) QT_NO_QDEBUG_MACRO()
+#endif
+#if XF_LOG_MIN_LEVEL <= 1
+#define xfInfo(category) qCInfo(category)
+#else
+#define xfInfo(category) QT_NO_QDEBUG_MACRO()
+#endif
+#if XF_LOG_MIN_LEVEL <= 2
+#define xfWarning(category) qCWarning(category)
+#else
+#define xfWarning(category) QT_NO_QDEBUG_MACRO()
+#endif
+#define xfCritical(category) qCCritical(category)
+
+// 键值字段：xfInfo(lcMonitor) << "new posts" << Logger::kv("count", n);
+// 输出为 count=12，便于按字段检索
+namespace Logger {
+    template <typename T>
+    struct Field {
+        const char* key;
+        const T& value;
+    };
+
+    template <typename T>
+    Field<T> kv(const char* key, const T& value) {
+        return Field<T>{key, value};
+    }
+}
+
+template <typename T>
+QDebug operator<<(QDebug debug, const Logger::Field<T>& field) {
+    QDebugStateSaver saver(debug);
+    debug.nospace().noquote() << field.key << '=' << field.value;
+    return debug;
+}
+
+// 异步文件日志
+// 调用线程只把 (时间戳, 文本) 放进无锁多生产者环形缓冲区，
+// 由独立写线程批量格式化写入 logs/debug_*.log：
+//   - 单文件超过 MAX_FILE_BYTES 或打开超过 MAX_FILE_AGE_SECS 时轮换，保留最近 KEEP_FILES 个
+//   - 缓冲区满时丢弃并计数，不阻塞调用线程
+//   - 退出时 shutdown() 写完剩余日志；error() 立即唤醒写线程；
+//     崩溃（未处理异常/terminate）时不取锁，把缓冲区剩余条目写进 debug_*_crash.log
+// init() 会安装 Qt 消息处理器，qDebug/qCInfo/xfInfo 等输出都会带级别和分类写入文件
 namespace Logger {
-    void init();
+    // logDir 为空时使用 exe目录/logs
+    void init(const QString& logDir = QString());
+
+    // 按分类设置运行期级别，例如 {"monitor": "warning", "storage": "debug"}
+    // 级别: debug / info / warning / critical / off
+    void applyLevels(const QJsonObject& levels);
+    void shutdown();
+    void flush(); // 在调用线程同步写完缓冲区
+
+    // 只写文件（原 CefHandler 的 writeLog）
+    void write(const QString& msg);
+
+    // 写文件并输出到调试控制台（xf.app 分类）
     void log(const QString& msg);
     void debug(const QString& msg);
     void info(const QString& msg);
     void warning(const QString& msg);
     void error(const QString& msg);
+
+    // 统计
+    quint64 droppedCount();
+
+    const int RING_CAPACITY = 8192;                    // 环形缓冲区槽位（2的幂）
+    const int WRITE_BATCH = 512;                       // 每批最多写入行数
+    const int WRITER_IDLE_MS = 200;                    // 写线程空闲等待（批量窗口）
+    const qint64 MAX_FILE_BYTES = 10 * 1024 * 1024;    // 单文件上限
+    const qint64 MAX_FILE_AGE_SECS = 24 * 3600;        // 单文件最长时间
+    const int KEEP_FILES = 20;                         // 保留的日志文件数
 }
 
 #endif // LOGGER_H
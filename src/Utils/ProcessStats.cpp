@@ -0,0 +1,53 @@
+#include "ProcessStats.h"
+#ifdef Q_OS_WIN
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+namespace ProcessStats {
+
+Sample sample(qint64 pid) {
+    Sample result;
+    if (pid <= 0) {
+        return result;
+    }
+#ifdef Q_OS_WIN
+    HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, static_cast<DWORD>(pid));
+    if (!process) {
+        return result;
+    }
+
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    PROCESS_MEMORY_COUNTERS_EX memory = {};
+    memory.cb = sizeof(memory);
+    DWORD exitCode = 0;
+    if (GetExitCodeProcess(process, &exitCode) && exitCode == STILL_ACTIVE &&
+        GetProcessTimes(process, &creationTime, &exitTime, &kernelTime, &userTime) &&
+        GetProcessMemoryInfo(process, reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&memory),
+                             sizeof(memory))) {
+        ULARGE_INTEGER kernel, user;
+        kernel.LowPart = kernelTime.dwLowDateTime;
+        kernel.HighPart = kernelTime.dwHighDateTime;
+        user.LowPart = userTime.dwLowDateTime;
+        user.HighPart = userTime.dwHighDateTime;
+
+        result.valid = true;
+        result.cpuTime100ns = static_cast<qint64>(kernel.QuadPart + user.QuadPart);
+        result.workingSetBytes = static_cast<qint64>(memory.WorkingSetSize);
+        result.privateBytes = static_cast<qint64>(memory.PrivateUsage);
+    }
+    CloseHandle(process);
+#endif
+    return result;
+}
+
+double cpuPercent(const Sample& before, const Sample& after, qint64 elapsedMs) {
+    if (!before.valid || !after.valid || elapsedMs <= 0 ||
+        after.cpuTime100ns < before.cpuTime100ns) {
+        return 0.0;
+    }
+    // 100ns -> ms: / 10000
+    return (after.cpuTime100ns - before.cpuTime100ns) / 10000.0 * 100.0 / elapsedMs;
+}
+
+} // namespace ProcessStats
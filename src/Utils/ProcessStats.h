@@ -0,0 +1,22 @@
+#ifndef PROCESSSTATS_H
+#define PROCESSSTATS_H
+
+#include <QtGlobal>
+
+// 进程 CPU 时间与内存占用采样（用于按浏览器统计渲染进程开销）
+namespace ProcessStats {
+    struct Sample {
+        bool valid = false;
+        qint64 cpuTime100ns = 0;    // 用户态+内核态累计（100ns 单位）
+        qint64 workingSetBytes = 0; // 工作集
+        qint64 privateBytes = 0;    // 私有提交内存
+    };
+
+    // pid <= 0 或进程已退出时返回 valid = false
+    Sample sample(qint64 pid);
+
+    // 两次采样之间的 CPU 占用（单核百分比）
+    double cpuPercent(const Sample& before, const Sample& after, qint64 elapsedMs);
+}
+
+#endif // PROCESSSTATS_H
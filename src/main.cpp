@@ -3,6 +3,7 @@
 #include <QDir>
 #include "App/CefApp.h"
 #include "UI/MainWindow.h"
+#include "Utils/Logger.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -30,13 +31,19 @@ int main(int argc, char* argv[]) {
     app.setOrganizationName("xfollowing");
     app.setApplicationVersion("1.0.5");
 
-    qDebug() << "[INFO] X互关宝启动中...";
+    // 异步文件日志（exe目录/logs）
+    Logger::init();
+
+    // CEF 消息泵挂到 Qt 事件循环（按 CEF 的调度请求唤醒）
+    CefHelper::StartMessagePump();
+
+    xfInfo(lcApp) << "X互关宝启动中...";
 
     // Create main window
     MainWindow* window = new MainWindow();
     window->show();
 
-    qDebug() << "[INFO] 主窗口已显示";
+    xfInfo(lcApp) << "主窗口已显示";
 
     // Run Qt event loop
     int result = app.exec();
@@ -46,5 +53,8 @@ int main(int argc, char* argv[]) {
     // Shutdown CEF
     CefHelper::Shutdown();
 
+    // 写完剩余日志
+    Logger::shutdown();
+
     return result;
 }
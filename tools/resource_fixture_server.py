@@ -0,0 +1,119 @@
+"""资源拦截验证用的本地测试页
+
+用法:
+    python resource_fixture_server.py [端口，默认8765]
+
+在 config.json 中设置 "scannerStartUrl": "http://127.0.0.1:8765/" 后启动程序，
+搜索浏览器会打开这个测试页。页面引用了图片、视频、字体和统计上报请求，
+服务端按类型记录收到的请求；扫描类浏览器应只请求页面本身和脚本。
+访问 http://127.0.0.1:8765/report 查看统计，Ctrl+C 退出时也会打印。
+"""
+import json
+import sys
+import threading
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+PAGE = b"""<!DOCTYPE html>
+<html>
+<head>
+<meta charset="utf-8">
+<title>xfollowing resource fixture</title>
+<style>
+@font-face { font-family: Fixture; src: url(/font/fixture.woff2) format("woff2"); }
+body { font-family: Fixture, sans-serif; }
+.banner { background-image: url(/img/banner.jpg); height: 40px; }
+</style>
+<script src="/js/app.js"></script>
+</head>
+<body>
+<div class="banner"></div>
+<article data-testid="tweet">
+  <img src="/img/avatar.jpg" alt="avatar">
+  <div data-testid="User-Name"><a href="/fixture_user">@fixture_user</a></div>
+  <div data-testid="tweetText">fixture post</div>
+  <video src="/media/clip.mp4" autoplay muted></video>
+</article>
+<script>
+fetch("/i/api/1.1/jot/client_event.json", {method: "POST", body: "{}"});
+</script>
+</body>
+</html>
+"""
+
+# 路径前缀 -> (分类, Content-Type, 响应大小)
+RESOURCES = {
+    "/img/": ("image", "image/jpeg", 25 * 1024),
+    "/media/": ("media", "video/mp4", 400 * 1024),
+    "/font/": ("font", "font/woff2", 30 * 1024),
+    "/i/api/1.1/jot/": ("tracking", "application/json", 64),
+    "/js/": ("script", "application/javascript", 0),
+}
+
+counts = {}
+lock = threading.Lock()
+
+
+def record(category):
+    with lock:
+        counts[category] = counts.get(category, 0) + 1
+
+
+def report():
+    with lock:
+        return dict(counts)
+
+
+class Handler(BaseHTTPRequestHandler):
+    def send_body(self, content_type, body):
+        self.send_response(200)
+        self.send_header("Content-Type", content_type)
+        self.send_header("Content-Length", str(len(body)))
+        self.send_header("Cache-Control", "no-store")
+        self.end_headers()
+        self.wfile.write(body)
+
+    def handle_request(self):
+        path = self.path.split("?")[0]
+        if path == "/report":
+            self.send_body("application/json", json.dumps(report()).encode("utf-8"))
+            return
+        if path in ("/", "/index.html"):
+            record("page")
+            self.send_body("text/html; charset=utf-8", PAGE)
+            return
+        for prefix, (category, content_type, size) in RESOURCES.items():
+            if path.startswith(prefix):
+                record(category)
+                body = b"// fixture\n" if category == "script" else b"\0" * size
+                self.send_body(content_type, body)
+                return
+        record("other")
+        self.send_response(404)
+        self.end_headers()
+
+    def do_GET(self):
+        self.handle_request()
+
+    def do_POST(self):
+        length = int(self.headers.get("Content-Length", 0))
+        self.rfile.read(length)
+        self.handle_request()
+
+    def log_message(self, fmt, *args):
+        print("[%s] %s" % (self.address_string(), fmt % args))
+
+
+if __name__ == "__main__":
+    port = int(sys.argv[1]) if len(sys.argv) > 1 else 8765
+    server = ThreadingHTTPServer(("127.0.0.1", port), Handler)
+    print(f"Fixture page: http://127.0.0.1:{port}/  report: http://127.0.0.1:{port}/report")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    print("Requests by type:", json.dumps(report(), ensure_ascii=False))
+    leaked = [c for c in ("image", "media", "font", "tracking") if report().get(c)]
+    if leaked:
+        print("未被拦截的类型:", ", ".join(leaked))
+    else:
+        print("图片/视频/字体/上报请求均未到达服务端")